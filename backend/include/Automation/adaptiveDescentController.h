@@ -2,6 +2,34 @@
 
 #include "Automation/iautopilot.h"
 
+/**
+ * @brief Tuning constants of the adaptive descent law.
+ *
+ * The defaults are the values the controller was tuned with. The scalar type
+ * is a template parameter so that a sensitivity run can trace derivatives
+ * with respect to individual gains.
+ *
+ * @tparam T Scalar type
+ */
+template<typename T>
+struct DescentGainsT
+{
+    T k_r_A     = T(0.25);  ///< [-] Reserve factor, energy dissipation
+    T k_r_B     = T(0.15);  ///< [-] Reserve factor, controlled descent
+    T k_r_C     = T(0.05);  ///< [-] Reserve factor, terminal approach
+    T k_r_D     = T(2.5);   ///< [-] Reserve factor, critical braking
+
+    T Kp_min    = T(0.8);   ///< [1/s] Proportional gain up to R_ref (terminal phase)
+    T Kp_max    = T(50.0);  ///< [1/s] Upper clamp of the proportional gain
+    T Kp_scale  = T(0.1);   ///< [1/s] Proportional gain increase per unit brake ratio beyond R_ref
+
+    T Kd_min    = T(0.05);  ///< [-] Derivative gain up to R_ref (terminal phase)
+    T Kd_max    = T(10.0);  ///< [-] Upper clamp of the derivative gain
+    T Kd_scale  = T(0.05);  ///< [-] Derivative gain increase per unit brake ratio beyond R_ref
+};
+
+using DescentGains = DescentGainsT<double>;
+
 /**
  * @brief Adaptive descent controller for lunar/planetary landers.
  *
@@ -42,6 +70,26 @@ public:
      */
     double setAutoThrustInNewton(IController *useController, const double &T_max, const double &vel, const double &h, const double &dt, const double &m, const double &g) const override;
 
+    /**
+     * @brief Descent law on an arbitrary scalar type.
+     *
+     * setAutoThrustInNewton evaluates this for double with the configured
+     * gains. Instantiated for double and SensitivityScalar.
+     *
+     * @tparam T Scalar type
+     * @param useController Controller of the same scalar type
+     * @param gains Tuning constants
+     * @param T_max Maximum thrust available [N]
+     * @param vel Current vertical velocity [m/s]
+     * @param h Current altitude [m]
+     * @param dt Timestep duration [s]
+     * @param m Lander mass [kg]
+     * @param g Local gravity [m/s²]
+     * @return Thrust command in Newtons for this timestep
+     */
+    template<typename T>
+    T computeThrust(const IControllerT<T> *useController, const DescentGainsT<T> &gains, const T &T_max, const T &vel, const T &h, const T &dt, const T &m, const T &g) const;
+
     /**
      * @brief Normalizes thrust into a 0..1 range based on maximum thrust.
      *
@@ -56,6 +104,27 @@ public:
      */
     std::string getDescentMode() const override;
 
+    /**
+     * @brief Captures the current descent mode
+     * @return Autopilot checkpoint
+     */
+    AutopilotCheckpoint captureCheckpoint() const override;
+
+    /**
+     * @brief Restores the descent mode
+     * @param checkpoint Autopilot checkpoint
+     */
+    void restoreCheckpoint(const AutopilotCheckpoint &checkpoint) override;
+
+    /// @return Tuning constants used by setAutoThrustInNewton
+    const DescentGains& getGains() const;
+
+    /**
+     * @brief Replaces the tuning constants
+     * @param gains New gains
+     */
+    void setGains(const DescentGains &gains);
+
 private:
     //***********************************************************
     //*************        Members                   ************
@@ -74,7 +143,12 @@ private:
     /**
      * @brief Current descent mode determined from brake ratio
      */
-    mutable DescentMode descentMode_;
+    mutable DescentMode descentMode_ = DescentMode::MODE_A;
+
+    /**
+     * @brief Tuning constants of the descent law
+     */
+    DescentGains gains_;
 
     //***********************************************************
     //*************    Memberfunctions                ************
@@ -88,7 +162,8 @@ private:
      * @param g Gravity [m/s²]
      * @return Maximum acceleration [m/s²], clamped to avoid division by zero
      */
-    double calcMaxAcc(const double &T_max, const double &m, const double &g) const;
+    template<typename T>
+    T calcMaxAcc(const T &T_max, const T &m, const T &g) const;
 
     /**
      * @brief Calculates the minimum braking distance for a given velocity and max acceleration.
@@ -97,7 +172,8 @@ private:
      * @param a_max Maximum available acceleration [m/s²]
      * @return Braking distance [m]
      */
-    double calcBrakingDistance(const double &vel, const double &a_max) const;
+    template<typename T>
+    T calcBrakingDistance(const T &vel, const T &a_max) const;
 
     /**
      * @brief Computes the brake ratio (h / d_brake) used to select the descent mode.
@@ -106,7 +182,8 @@ private:
      * @param d_brake Required braking distance [m]
      * @return Brake ratio (unitless)
      */
-    double calcBrakeRatio(const double &h, const double &d_brake) const;
+    template<typename T>
+    T calcBrakeRatio(const T &h, const T &d_brake) const;
 
     /**
      * @brief Calculates the target velocity for the next timestep.
@@ -118,7 +195,8 @@ private:
      * @param k_r Reserve factor for safe descent
      * @return Target vertical velocity [m/s]
      */
-    double calcTargetVelocity(const double &a_max, const double &h, const double k_r, const double &vel, const double &dt) const;
+    template<typename T>
+    T calcTargetVelocity(const T &a_max, const T &h, const T k_r, const T &vel, const T &dt) const;
 
     /**
      * @brief Calculates the hover thrust required to balance gravity.
@@ -127,7 +205,8 @@ private:
      * @param g Gravity [m/s²]
      * @return Hover thrust [N]
      */
-    double calcHoverThrust(const double &m, const double &g) const;
+    template<typename T>
+    T calcHoverThrust(const T &m, const T &g) const;
 
     /**
      * @brief Calculates normalized hover throttle (0..1) based on T_max.
@@ -153,7 +232,8 @@ private:
      *
      * @note The resulting thrust can be used directly to compute actuator commands.
      */
-    double calcThrustCommand(const double &T_hover, const double &a_controlled, const double &m) const;
+    template<typename T>
+    T calcThrustCommand(const T &T_hover, const T &a_controlled, const T &m) const;
 
     /**
      * @brief Saturates thrust command to allowed range [0, T_max].
@@ -162,7 +242,8 @@ private:
      * @param T_max Maximum thrust [N]
      * @return Clamped thrust [N]
      */
-    double calcSaturation(const double &T_cmd, const double &T_max) const;
+    template<typename T>
+    T calcSaturation(const T &T_cmd, const T &T_max) const;
 
     /**
      * @brief Normalizes thrust command to 0..1 range.
@@ -177,30 +258,37 @@ private:
      * @brief Interpolates reserve factor k_r based on brake ratio.
      *
      * @param R_brake Current brake ratio
+     * @param gains Tuning constants
      * @return Interpolated k_r for target velocity computation
      */
-    double interpolate_k_r(double R_brake) const;
+    template<typename T>
+    T interpolate_k_r(const T &R_brake, const DescentGainsT<T> &gains) const;
 
     /**
      * @brief Interpolates proportional gain K_p for PD controller based on brake ratio.
      *
      * @param R_brake Current brake ratio
+     * @param gains Tuning constants
      * @return Interpolated K_p
      */
-    double interpolate_Kp(double R_brake) const;
+    template<typename T>
+    T interpolate_Kp(const T &R_brake, const DescentGainsT<T> &gains) const;
 
     /**
      * @brief Interpolates derivative gain K_d for PD controller based on brake ratio.
      *
      * @param R_brake Current brake ratio
+     * @param gains Tuning constants
      * @return Interpolated K_d
      */
-    double interpolate_Kd(double R_brake) const;
+    template<typename T>
+    T interpolate_Kd(const T &R_brake, const DescentGainsT<T> &gains) const;
 
     /**
      * @brief Determine Braking Mode due to R_brake factor
      * @param R_brake brake ratio (h / d_brake)
      * @return Current descent mode
      */
-    DescentMode determineMode(double R_brake) const;
+    template<typename T>
+    DescentMode determineMode(const T &R_brake) const;
 };
@@ -57,6 +57,14 @@ enum class DescentMode
     MODE_D
 };
 
+/**
+ * @brief Dynamic autopilot state as stored in a simulation checkpoint.
+ */
+struct AutopilotCheckpoint
+{
+    DescentMode descentMode = DescentMode::MODE_A;  ///< Active descent phase
+};
+
 class IAutopilot{
 public:
     virtual ~IAutopilot() = default;
@@ -66,4 +74,8 @@ public:
     virtual double normalizAutoThrust(const double &thrustInNewton, const double &T_max) const = 0;
 
     virtual std::string getDescentMode() const = 0;
+
+    virtual AutopilotCheckpoint captureCheckpoint() const = 0;
+
+    virtual void restoreCheckpoint(const AutopilotCheckpoint &checkpoint) = 0;
 };
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Binary simulation checkpoint.
+ *
+ * A checkpoint is a flat byte blob produced by @ref simcontrol::checkpoint and
+ * consumed by @ref simcontrol::restore. It starts with a @ref SimCheckpointHeader
+ * followed by the lander count, the position in the rate schedule and, per
+ * lander, the dynamic state of every subsystem, each written as a trivially
+ * copyable struct.
+ *
+ * The blob only holds dynamic state. Configuration (engines, tanks, mass
+ * properties) is not part of it, so a checkpoint can only be restored into a
+ * simulation that was initialized with the same spacecraft configuration.
+ *
+ * Values are stored in host byte order. The format is meant for in-process
+ * retries and same-machine crash recovery, not for exchange between platforms.
+ */
+using SimCheckpoint = std::vector<std::uint8_t>;
+
+/**
+ * @brief Fixed header at the start of every checkpoint blob.
+ */
+struct SimCheckpointHeader
+{
+    std::uint32_t magic = 0;        ///< Identifies the blob as a Moonlander checkpoint
+    std::uint16_t version = 0;      ///< Layout version of the payload
+    std::uint16_t reserved = 0;     ///< Padding, always zero
+    std::uint64_t payloadSize = 0;  ///< [bytes] Size of the data following the header
+};
+
+/// "MLCK" in little endian
+inline constexpr std::uint32_t SIM_CHECKPOINT_MAGIC   = 0x4B434C4D;
+
+/// Current payload layout. Bump whenever a checkpoint struct changes.
+inline constexpr std::uint16_t SIM_CHECKPOINT_VERSION = 6;
+
+/**
+ * @brief Appends trivially copyable values to a checkpoint blob.
+ *
+ * The writer only grows the blob. If the blob was cleared but kept its
+ * capacity (e.g. when the same buffer is reused every step), writing does
+ * not allocate.
+ */
+class CheckpointWriter
+{
+public:
+    explicit CheckpointWriter(SimCheckpoint& blob) : blob_(blob) {}
+
+    template<typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        write(&value, 1);
+    }
+
+    template<typename T>
+    void write(const T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        const std::size_t offset = blob_.size();
+        blob_.resize(offset + sizeof(T) * count);
+        std::memcpy(blob_.data() + offset, values, sizeof(T) * count);
+    }
+
+    /// @return Current write position [bytes]
+    std::size_t position() const { return blob_.size(); }
+
+    /// @brief Overwrites an already written value at @p offset.
+    template<typename T>
+    void patch(std::size_t offset, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        std::memcpy(blob_.data() + offset, &value, sizeof(T));
+    }
+
+private:
+    SimCheckpoint& blob_;
+};
+
+/**
+ * @brief Reads trivially copyable values back from a checkpoint blob.
+ *
+ * Every read is bounds checked; a truncated blob raises std::runtime_error
+ * instead of reading past the end.
+ */
+class CheckpointReader
+{
+public:
+    CheckpointReader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    void read(T& value)
+    {
+        read(&value, 1);
+    }
+
+    template<typename T>
+    void read(T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        const std::size_t bytes = sizeof(T) * count;
+        if (bytes > size_ - offset_)
+        {
+            throw std::runtime_error("Checkpoint truncated at byte " + std::to_string(offset_));
+        }
+        std::memcpy(values, data_ + offset_, bytes);
+        offset_ += bytes;
+    }
+
+    /// @return Current read position [bytes]
+    std::size_t position() const { return offset_; }
+
+    /// @return Bytes left to read
+    std::size_t remaining() const { return size_ - offset_; }
+
+private:
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::size_t offset_ = 0;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Checkpoint/simCheckpoint.h"
+
+#include <cstddef>
+#include <vector>
+
+class simcontrol;
+
+/**
+ * @class SnapshotRingBuffer
+ * @brief Bounded history of periodic simulation checkpoints used for rewind.
+ *
+ * The buffer holds up to @c capacity checkpoints taken every @c interval
+ * seconds of simulated time. When full, the oldest snapshot is overwritten.
+ * Slot storage is reused: after the first snapshot every slot reserves the
+ * checkpoint size, so steady-state recording does not allocate.
+ *
+ * Rewinding restores the newest snapshot that is at least the requested
+ * amount of time in the past and drops every snapshot after it, so the
+ * history stays consistent with the branch the pilot continues on.
+ *
+ * Example: 600 slots at 1 s cover the last 10 minutes of flight.
+ */
+class SnapshotRingBuffer
+{
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of stored snapshots
+     * @param interval [s] Simulated time between two snapshots
+     */
+    SnapshotRingBuffer(std::size_t capacity, double interval);
+
+    /**
+     * @brief Drops all snapshots. Slot storage is kept.
+     */
+    void clear();
+
+    /**
+     * @brief Takes a snapshot if the snapshot interval has elapsed.
+     *
+     * Intended to be called after every simulation step. The first call after
+     * @ref clear always records.
+     *
+     * @param sim Simulation to capture
+     * @return true if a snapshot was recorded
+     */
+    bool record(const simcontrol& sim);
+
+    /**
+     * @brief Restores the simulation to a point in the past.
+     *
+     * Selects the newest snapshot taken at or before
+     * @c sim.getSimulationTime() - @p seconds. If the request reaches beyond
+     * the stored history, the oldest snapshot is used.
+     *
+     * @param sim Simulation to restore
+     * @param seconds [s] How far to rewind
+     * @return true if a snapshot was restored, false if the buffer is empty
+     */
+    bool rewind(simcontrol& sim, double seconds);
+
+    /// @return Number of stored snapshots
+    std::size_t size() const;
+
+    /// @return Maximum number of stored snapshots
+    std::size_t capacity() const;
+
+    /// @return [s] Simulated time covered between oldest and newest snapshot
+    double span() const;
+
+private:
+    /**
+     * @brief One stored snapshot
+     */
+    struct Slot
+    {
+        double time = 0.0;      ///< [s] Simulation time of the snapshot
+        SimCheckpoint blob;     ///< Checkpoint data
+    };
+
+    /// @return Physical slot index of the i-th oldest snapshot
+    std::size_t slotIndex(std::size_t i) const;
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    std::vector<Slot> slots_;       ///< Preallocated slot storage
+    double interval_;               ///< [s] Snapshot interval
+    double nextSnapshotTime_ = 0.0; ///< [s] Simulation time of the next due snapshot
+    std::size_t head_ = 0;          ///< Slot index of the oldest snapshot
+    std::size_t count_ = 0;         ///< Number of valid snapshots
+    bool reserved_ = false;         ///< Slot storage sized to the checkpoint layout
+};
@@ -62,11 +62,25 @@ struct ControlCommand{
     bool killRotation = false;
 };
 
+/**
+ * @brief Arbiter state as stored in a simulation checkpoint.
+ */
+struct ArbiterCheckpoint
+{
+    ControlCommand usrCmd;              ///< Last user command
+    ControlCommand autoCmd;             ///< Last autopilot command
+    bool automationActive = false;      ///< Source selection flag
+};
+
 class InputArbiter{
 public:
     ControlCommand chooseCommand();
     void receiveUserControlCommand(const ControlCommand &userCmd);
     void receiveAutoControlCommand(const ControlCommand &autoCmd);
+    bool isAutomationActive() const;
+
+    ArbiterCheckpoint captureCheckpoint() const;
+    void restoreCheckpoint(const ArbiterCheckpoint &checkpoint);
 
 private:
     void setAutomationActiveFlag(bool on);
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Periodic tasks of a simulation step, in execution order within a tick.
+ */
+enum class SimTask : std::uint8_t
+{
+    Autopilot,      ///< Guidance and control command on the navigation estimate
+    Propulsion,     ///< Engine response, mass flow, tank masses
+    Physics,        ///< Translation and attitude integration
+    Sensors,        ///< Sensor sampling and navigation filter
+    Count
+};
+
+/**
+ * @brief Execution rates of the simulation tasks [Hz].
+ *
+ * The physics rate defines the tick. Every other rate must divide it, e.g.
+ * 1000 / 500 / 200 / 50 Hz run every 1st, 2nd, 5th and 20th tick.
+ */
+struct TaskRates
+{
+    double autopilot = 50.0;
+    double propulsion = 500.0;
+    double physics = 1000.0;
+    double sensors = 200.0;
+};
+
+/**
+ * @class RateSchedule
+ * @brief Static cyclic schedule of the simulation tasks.
+ *
+ * The schedule is computed once from @ref TaskRates. A task with divisor d
+ * runs in every tick k with k mod d = 0. The pattern repeats after the major
+ * frame of lcm(d) ticks and is stored as one bit mask per tick. Whether a task
+ * is due is then a table lookup, and the sequence of task executions depends
+ * only on the tick number. It does not depend on how the caller splits
+ * simulation time into runSimulation calls.
+ *
+ * Within a tick the tasks run in @ref SimTask order. A task that runs every
+ * d ticks integrates over d · @ref tickPeriod.
+ */
+class RateSchedule
+{
+public:
+    /**
+     * @brief Builds the schedule
+     * @param rates Task rates
+     * @throws std::runtime_error if a rate is not positive, exceeds the physics
+     *         rate or does not divide it
+     */
+    explicit RateSchedule(const TaskRates& rates = TaskRates{});
+
+    /// @return Duration of one tick, the physics period [s]
+    double tickPeriod() const;
+
+    /**
+     * @brief Period of a task
+     * @param task Task
+     * @return Time between two executions [s]
+     */
+    double period(SimTask task) const;
+
+    /**
+     * @brief Whether a task runs in a tick
+     * @param task Task
+     * @param tick Global tick number
+     */
+    bool isDue(SimTask task, std::uint64_t tick) const
+    {
+        return (frame_[tick % frame_.size()] >> static_cast<unsigned>(task)) & 1u;
+    }
+
+    /// @return Number of ticks after which the schedule repeats
+    std::size_t majorFrame() const;
+
+    /// @return Rates the schedule was built from
+    const TaskRates& rates() const;
+
+private:
+    static constexpr std::size_t TASKS = static_cast<std::size_t>(SimTask::Count);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    TaskRates rates_;                               ///< Requested rates
+    double tickPeriod_ = 0.0;                       ///< [s] Physics period
+    std::array<std::uint64_t, TASKS> divisor_{};    ///< Ticks between executions per task
+    std::vector<std::uint8_t> frame_;               ///< Due tasks per tick of the major frame, bit = SimTask
+};
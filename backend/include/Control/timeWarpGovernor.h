@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+
+/**
+ * @brief Limits applied by the time warp governor.
+ */
+struct TimeWarpLimits
+{
+    double maxWarpUnderThrust = 1.0;    ///< [-] Warp cap while any engine produces or is commanded thrust
+    double maxGLoad = 0.5;              ///< [g] Above this load only real time is allowed
+    double altitudePerWarp = 50.0;      ///< [m] Altitude required per warp factor, e.g. x100 needs 5 km
+};
+
+/**
+ * @class TimeWarpGovernor
+ * @brief Decides how much time warp a flight situation allows.
+ *
+ * The pilot requests a warp level; the governor reduces it whenever warp
+ * would hide something the pilot has to react to: a running engine, a high
+ * G-load, or the approach to the ground. The result is always one of
+ * @ref LEVELS, so the cockpit shows the same steps the pilot can select.
+ *
+ * The governor only picks the factor. Integration stays at the safe step
+ * size; a higher warp means more steps per frame (see
+ * simcontrol::advanceSimulation).
+ */
+class TimeWarpGovernor
+{
+public:
+    /// Selectable warp levels [-]
+    static constexpr std::array<double, 7> LEVELS{1.0, 2.0, 5.0, 10.0, 100.0, 500.0, 1000.0};
+
+    /**
+     * @brief Constructor
+     * @param limits Warp limits
+     */
+    explicit TimeWarpGovernor(const TimeWarpLimits& limits = TimeWarpLimits{});
+
+    /**
+     * @brief Returns the warp level allowed for one lander.
+     *
+     * @param requested     Warp requested by the pilot [-]
+     * @param altitude      Altitude above ground [m]
+     * @param GLoad         Current proper acceleration [g]
+     * @param thrustActive  True if any engine produces or is commanded thrust
+     * @return Largest level not above @p requested and all caps, at least 1
+     */
+    double limit(double requested, double altitude, double GLoad, bool thrustActive) const;
+
+    /**
+     * @brief Largest level not above a factor
+     * @param warp Warp factor [-]
+     * @return Warp level, at least 1
+     */
+    static double snapToLevel(double warp);
+
+    /// @return Active limits
+    const TimeWarpLimits& limits() const;
+
+    /**
+     * @brief Replaces the limits
+     * @param limits New warp limits
+     */
+    void setLimits(const TimeWarpLimits& limits);
+
+private:
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    TimeWarpLimits limits_;     ///< Active limits
+};
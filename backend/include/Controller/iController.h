@@ -1,19 +1,30 @@
 #pragma once
 
+/**
+ * @brief Dynamic controller state as stored in a simulation checkpoint.
+ */
+struct ControllerCheckpoint
+{
+    double errorOld = 0.0;  ///< Error of the previous control step
+};
+
 /**
  * @brief Abstract base class for all controllers.
  *
  * Defines the interface for a generic controller that calculates a control signal
  * based on a target and measured value. Designed to be overridden by specific
  * controller types (e.g., PD, PID, Bang-Bang).
+ *
+ * @tparam T Scalar type. The simulation uses the double alias @ref IController.
  */
-class IController
+template<typename T>
+class IControllerT
 {
 public:
     /**
      * @brief Virtual destructor for safe polymorphic deletion.
      */
-    virtual ~IController() = default;
+    virtual ~IControllerT() = default;
 
     /**
      * @brief Compute the control output for a single timestep.
@@ -27,5 +38,22 @@ public:
      *
      * @note This function is intended to be overridden in derived classes.
      */
-    virtual double control(const double &targetValue, const double &measuredValue, const double &K_p, const double &K_d, const double &dt) const = 0;
+    virtual T control(const T &targetValue, const T &measuredValue, const T &K_p, const T &K_d, const T &dt) const = 0;
+
+    /**
+     * @brief Captures the internal controller memory.
+     *
+     * Only values are stored; derivatives of a sensitivity run are dropped.
+     *
+     * @return Controller checkpoint
+     */
+    virtual ControllerCheckpoint captureCheckpoint() const = 0;
+
+    /**
+     * @brief Restores the internal controller memory.
+     * @param checkpoint Controller checkpoint captured by captureCheckpoint
+     */
+    virtual void restoreCheckpoint(const ControllerCheckpoint &checkpoint) = 0;
 };
+
+using IController = IControllerT<double>;
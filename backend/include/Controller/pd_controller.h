@@ -8,8 +8,12 @@
  * Calculates a control output using a proportional and derivative term based
  * on the target and measured value. Maintains previous error internally to
  * compute the derivative term.
+ *
+ * @tparam T Scalar type, instantiated for double and SensitivityScalar in
+ *           pd_controller.cpp.
  */
-class PD_Controller : public IController
+template<typename T>
+class PD_ControllerT : public IControllerT<T>
 {
 public:
     /**
@@ -24,7 +28,19 @@ public:
      *
      * @note Overrides IController::control.
      */
-    double control(const double &targetValue, const double &measuredValue, const double &K_p, const double &K_d, const double &dt) const override;
+    T control(const T &targetValue, const T &measuredValue, const T &K_p, const T &K_d, const T &dt) const override;
+
+    /**
+     * @brief Captures the previous error used by the derivative term.
+     * @return Controller checkpoint
+     */
+    ControllerCheckpoint captureCheckpoint() const override;
+
+    /**
+     * @brief Restores the previous error used by the derivative term.
+     * @param checkpoint Controller checkpoint
+     */
+    void restoreCheckpoint(const ControllerCheckpoint &checkpoint) override;
 
 private:
     //***********************************************************
@@ -36,7 +52,7 @@ private:
      *
      * Mutable to allow modification in const compute function.
      */
-    mutable double error_old_ = 0.0;
+    mutable T error_old_ = T(0.0);
 
     //***********************************************************
     //*************        Methods                   ************
@@ -49,7 +65,7 @@ private:
      * @param measureValue Current measured value.
      * @return Error = target - measured.
      */
-    double calcError(const double &targetValue, const double &measureValue) const;
+    T calcError(const T &targetValue, const T &measureValue) const;
 
     /**
      * @brief Calculate the derivative term from current and previous error.
@@ -59,5 +75,7 @@ private:
      * @param dt Time step.
      * @return Derivative term (change rate of error).
      */
-    double calcDifferential(const double &error, const double &error_old, const double &dt) const;
+    T calcDifferential(const T &error, const T &error_old, const T &dt) const;
 };
+
+using PD_Controller = PD_ControllerT<double>;
@@ -3,7 +3,7 @@
 #include "Integrators/iIntegrator.h"
 
 /**
- * @class EulerIntegrator
+ * @class EulerIntegratorT
  * @brief Concrete integrator implementing the explicit Euler method.
  *
  * The EulerIntegrator advances position and velocity using a first–order
@@ -11,8 +11,12 @@
  *
  * This class is purely numerical and independent of any physical model.
  * It operates only on vectors and time deltas.
+ *
+ * @tparam T Scalar type, instantiated for float, double and
+ *           SensitivityScalar in eulerIntegrator.cpp.
  */
-class EulerIntegrator : public IIntegrator {
+template<typename T>
+class EulerIntegratorT : public IIntegratorT<T> {
 public:
 
     /**
@@ -26,7 +30,7 @@ public:
      * @param dt  Time step in seconds.
      * @return Updated velocity vector after dt.
      */
-    virtual Vector3 integrateVel(const Vector3& vel, const Vector3& acc, double dt) const override;
+    virtual Vector3T<T> integrateVel(const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const override;
 
     /**
      * @brief Integrates position over a timestep using Euler integration.
@@ -42,5 +46,10 @@ public:
      * @param dt  Time step in seconds.
      * @return Updated position vector after dt.
      */
-    virtual Vector3 integratePos(const Vector3& pos, const Vector3& vel, const Vector3& acc, double dt) const override;
+    virtual Vector3T<T> integratePos(const Vector3T<T>& pos, const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const override;
 };
+
+extern template class EulerIntegratorT<double>;
+extern template class EulerIntegratorT<float>;
+
+using EulerIntegrator = EulerIntegratorT<double>;
@@ -3,7 +3,7 @@
 #include "vector3.h"
 
 /**
- * @class IIntegrator
+ * @class IIntegratorT
  * @brief Interface for numerical time integration of motion equations.
  *
  * IIntegrator defines the contract for all numerical integrators used
@@ -14,14 +14,18 @@
  * Typical implementations are Euler, Semi-Implicit Euler, Verlet or RK4.
  * The integrator operates on position, velocity and acceleration vectors
  * and a discrete timestep.
+ *
+ * @tparam T Scalar type (float or double). The simulation uses the double
+ *           alias @ref IIntegrator.
  */
-class IIntegrator {
+template<typename T>
+class IIntegratorT {
 public:
 
     /**
      * @brief Virtual destructor to allow proper cleanup of derived classes.
      */
-    virtual ~IIntegrator() = default;
+    virtual ~IIntegratorT() = default;
 
     /**
      * @brief Integrates velocity over a timestep.
@@ -34,7 +38,7 @@ public:
      * @param dt  Time step in seconds.
      * @return Updated velocity vector after dt.
      */
-    virtual Vector3 integrateVel(const Vector3& vel, const Vector3& acc, double dt) const = 0;
+    virtual Vector3T<T> integrateVel(const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const = 0;
 
     /**
      * @brief Integrates position over a timestep.
@@ -48,5 +52,7 @@ public:
      * @param dt  Time step in seconds.
      * @return Updated position vector after dt.
      */
-    virtual Vector3 integratePos(const Vector3& pos, const Vector3& vel, const Vector3& acc, double dt) const = 0;
+    virtual Vector3T<T> integratePos(const Vector3T<T>& pos, const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const = 0;
 };
+
+using IIntegrator = IIntegratorT<double>;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "vector3.h"
+
+#include <limits>
+
+/**
+ * @class KeplerPropagator
+ * @brief Closed-form two-body propagation for unpowered flight.
+ *
+ * Propagates a state in a point-mass field with universal variables, so
+ * elliptic, parabolic and hyperbolic arcs are handled by the same code and
+ * the cost does not depend on the length of the time span. Used to fast
+ * forward coast phases instead of stepping the integrator.
+ *
+ * Positions are relative to the center of the attracting body.
+ */
+class KeplerPropagator
+{
+public:
+    /// Returned by @ref timeToRadius if the radius is never reached
+    static constexpr double NEVER = std::numeric_limits<double>::infinity();
+
+    /**
+     * @brief Constructor
+     * @param mu Gravitational parameter of the central body [m³/s²]
+     */
+    explicit KeplerPropagator(double mu);
+
+    /**
+     * @brief Propagates a state by a time span.
+     * @param pos Position [m], overwritten with the position after @p dt
+     * @param vel Velocity [m/s], overwritten with the velocity after @p dt
+     * @param dt  Time span [s], may be negative
+     */
+    void propagate(Vector3& pos, Vector3& vel, double dt) const;
+
+    /**
+     * @brief Time until the orbit first reaches a given radius.
+     *
+     * Solves Kepler's equation for the crossing analytically: the radius
+     * is a function of the eccentric (or hyperbolic) anomaly only.
+     *
+     * @param pos    Position [m]
+     * @param vel    Velocity [m/s]
+     * @param radius Target distance from the center [m]
+     * @return Time of the first crossing after now [s], or @ref NEVER
+     */
+    double timeToRadius(const Vector3& pos, const Vector3& vel, double radius) const;
+
+    /// @return Gravitational parameter [m³/s²]
+    double mu() const;
+
+private:
+    /**
+     * @brief Stumpff functions C(z) and S(z)
+     */
+    static void stumpff(double z, double& c, double& s);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    double mu_;     ///< [m³/s²] Gravitational parameter
+};
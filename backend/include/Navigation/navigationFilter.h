@@ -0,0 +1,192 @@
+#pragma once
+
+#include "vector3.h"
+#include "quaternion.h"
+#include "matrix.h"
+#include "environmentConfig.h"
+#include "Terrain/iTerrainModel.h"
+#include "Sensory_Perception/sensorSuite.h"
+
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Noise assumptions of the @ref NavigationFilter.
+ *
+ * The measurement noise matches the defaults of the sensor models. The
+ * process noise covers accelerometer noise and bias, unmodelled gravity and
+ * the difference between commanded and actual mass flow.
+ */
+struct NavigationNoise
+{
+    double accelerationNoise = 0.02;        ///< [m/s²/√Hz] White acceleration noise driving velocity
+    double massFlowNoise = 0.1;             ///< [kg/s/√Hz] White mass flow noise
+
+    double initialPositionSigma = 10.0;     ///< [m]
+    double initialVelocitySigma = 0.5;      ///< [m/s]
+    double initialMassSigma = 5.0;          ///< [kg]
+
+    double radarNoise = 0.05;               ///< [m] Constant part of the range standard deviation
+    double radarNoiseScale = 0.005;         ///< [-] Range-proportional part
+    double velocimeterNoise = 0.02;         ///< [m/s] Constant part of the velocity standard deviation
+    double velocimeterNoiseScale = 0.002;   ///< [-] Speed-proportional part
+};
+
+/**
+ * @brief Navigation solution handed to guidance.
+ */
+struct NavigationEstimate
+{
+    Vector3 I_position{0.0, 0.0, 0.0};      ///< [m] Moon-centered position
+    Vector3 I_velocity{0.0, 0.0, 0.0};      ///< [m/s] Velocity
+    double mass = 0.0;                      ///< [kg] Total mass
+    double altitude = 0.0;                  ///< [m] Height above the terrain below the estimated position
+};
+
+/**
+ * @class NavigationFilter
+ * @brief Extended Kalman filter for position, velocity and mass.
+ *
+ * State x = [r, v, m] (7 values) in the Moon-centered frame.
+ *
+ * Predict, every IMU sample:
+ *   v += (R(q)·f + g(r))·dt,  r += v·dt,  m -= ṁ·dt
+ * with the measured specific force f, the point-mass gravity g and the
+ * commanded mass flow ṁ. The covariance is propagated with the Jacobian of
+ * this step, including the gravity gradient.
+ *
+ * Update, whenever a measurement arrives:
+ * - radar slant range (|r| - R_moon - terrain) / cos(tilt)
+ * - each velocimeter axis e_kᵀ R(q)ᵀ v as a separate scalar update
+ *
+ * Scalar updates need no matrix inversion; the gain is P·Hᵀ / (H·P·Hᵀ + σ²).
+ * Innovations beyond @ref GATE standard deviations are rejected.
+ *
+ * All storage is fixed-size (@ref Matrix), nothing is allocated after
+ * construction. A predict costs two 7 × 7 products, a scalar update about
+ * 100 flops.
+ *
+ * Attitude is not estimated yet. The filter takes the orientation as an
+ * input and the caller passes the true one.
+ */
+class NavigationFilter
+{
+public:
+    static constexpr std::size_t STATES = 7;
+
+    using State      = VectorN<STATES>;
+    using Covariance = Matrix<STATES, STATES>;
+
+    /// [-] Innovation gate in standard deviations
+    static constexpr double GATE = 5.0;
+
+    /**
+     * @brief Dynamic filter state as stored in a simulation checkpoint.
+     */
+    struct Checkpoint
+    {
+        State x{};
+        Covariance P{};
+    };
+
+    /**
+     * @brief Constructor
+     * @param cfg Environment constants (gravitational parameter, Moon radius)
+     * @param noise Noise assumptions
+     */
+    explicit NavigationFilter(const EnvironmentConfig& cfg, const NavigationNoise& noise = {});
+
+    /**
+     * @brief Sets the terrain used to convert the position into an altitude
+     * @param terrain Surface height model, nullptr for a spherical moon
+     */
+    void setTerrainModel(std::shared_ptr<const ITerrainModel> terrain);
+
+    /**
+     * @brief Starts the filter at a known state with the initial uncertainty of @ref NavigationNoise
+     * @param I_position Position [m]
+     * @param I_velocity Velocity [m/s]
+     * @param mass Total mass [kg]
+     */
+    void initialize(const Vector3& I_position, const Vector3& I_velocity, double mass);
+
+    /**
+     * @brief Propagates the estimate with an accelerometer sample
+     * @param B_specificForce Measured specific force in the body frame [m/s²]
+     * @param IB_orientation Orientation of the body frame
+     * @param massFlow Commanded propellant mass flow [kg/s]
+     * @param dt Time step [s]
+     */
+    void predict(const Vector3& B_specificForce, const Quaternion& IB_orientation, double massFlow, double dt);
+
+    /**
+     * @brief Propagates the estimate over an unpowered coast without IMU samples
+     *
+     * The mean follows the Kepler orbit. The covariance is propagated with the
+     * state transition matrix of the Kepler flow, taken by central differences
+     * of the closed-form propagation (12 extra propagations), so it stays
+     * valid over coasts of any length.
+     * @param mu Gravitational parameter [m³/s²]
+     * @param duration Coast duration [s]
+     */
+    void coast(double mu, double duration);
+
+    /**
+     * @brief Corrects the estimate with a radar slant range
+     * @param range Measured slant range along body -z [m]
+     * @param IB_orientation Orientation of the body frame
+     * @return True if the measurement passed the gate
+     */
+    bool updateRadar(double range, const Quaternion& IB_orientation);
+
+    /**
+     * @brief Corrects the estimate with a velocimeter measurement
+     * @param B_velocity Measured velocity in the body frame [m/s]
+     * @param IB_orientation Orientation of the body frame
+     * @return Number of axes that passed the gate
+     */
+    int updateVelocimeter(const Vector3& B_velocity, const Quaternion& IB_orientation);
+
+    /**
+     * @brief Predicts with the IMU sample and applies the new measurements of a sensor suite
+     * @param readings Readings of the last SensorSuite::sample
+     * @param IB_orientation Orientation of the body frame
+     * @param massFlow Commanded propellant mass flow [kg/s]
+     * @param dt Time step [s]
+     */
+    void process(const SensorReadings& readings, const Quaternion& IB_orientation, double massFlow, double dt);
+
+    /// @return Current navigation solution
+    NavigationEstimate estimate() const;
+
+    /// @return Height above the terrain below the estimated position [m]
+    double altitude() const;
+
+    /// @return Covariance of [r, v, m]
+    const Covariance& covariance() const;
+
+    Checkpoint captureCheckpoint() const;
+
+    void restoreCheckpoint(const Checkpoint& checkpoint);
+
+private:
+    /**
+     * @brief Kalman update with one scalar measurement
+     * @param H Measurement Jacobian (row stored as column vector)
+     * @param residual Measurement minus prediction
+     * @param variance Measurement noise variance
+     * @return True if the innovation passed the gate
+     */
+    bool scalarUpdate(const State& H, double residual, double variance);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    const EnvironmentConfig& configData;
+    NavigationNoise noise_;                         ///< Noise assumptions
+    std::shared_ptr<const ITerrainModel> terrain_;  ///< Surface height model
+
+    State x_{};                                     ///< Estimate [r, v, m]
+    Covariance P_{};                                ///< Estimate covariance
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "customSpacecraftStruct.h"
+#include "environmentConfig.h"
+#include "Automation/adaptiveDescentController.h"
+#include "dual.h"
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief Parameters traced by DescentSensitivity, used as derivative index.
+ */
+enum class SensitivityParameter : std::size_t
+{
+    MaxThrust,          ///< [N] Maximum thrust of main engine 0
+    Isp,                ///< [s] Specific impulse of main engine 0
+    EmptyMass,          ///< [kg] Dry mass of the lander
+    ProportionalGain,   ///< [1/s] Terminal proportional gain DescentGains::Kp_min
+    DerivativeGain      ///< [-] Terminal derivative gain DescentGains::Kd_min
+};
+
+static_assert(static_cast<std::size_t>(SensitivityParameter::DerivativeGain) + 1 == SENSITIVITY_PARAMETERS,
+              "SENSITIVITY_PARAMETERS must match SensitivityParameter");
+
+/**
+ * @brief Outcome of an autopilot descent and its derivatives.
+ *
+ * Gradients are indexed by SensitivityParameter.
+ */
+struct DescentSensitivityResult
+{
+    bool   touchedDown          = false;    ///< false if maxTime elapsed in flight
+    double touchdownTime        = 0.0;      ///< [s] Time of surface contact
+    double touchdownVelocity    = 0.0;      ///< [m/s] Vertical velocity at contact
+    double fuelUsed             = 0.0;      ///< [kg] Fuel burned until contact
+
+    std::array<double, SENSITIVITY_PARAMETERS> dTouchdownVelocity{};   ///< ∂v_td/∂p
+    std::array<double, SENSITIVITY_PARAMETERS> dFuelUsed{};            ///< ∂m_fuel/∂p
+
+    /**
+     * @param p Parameter
+     * @return ∂touchdownVelocity/∂p
+     */
+    double touchdownVelocityGradient(SensitivityParameter p) const { return dTouchdownVelocity[static_cast<std::size_t>(p)]; }
+
+    /**
+     * @param p Parameter
+     * @return ∂fuelUsed/∂p
+     */
+    double fuelUsedGradient(SensitivityParameter p) const { return dFuelUsed[static_cast<std::size_t>(p)]; }
+};
+
+/**
+ * @class DescentSensitivity
+ * @brief Forward-mode sensitivities of an autopilot landing.
+ *
+ * Flies one autopilot descent with SensitivityScalar instead of double. It
+ * uses the same code as the simulation for AdaptiveDescentController,
+ * PD_ControllerT, the basicMainEngineModel response, BasicMoonGravityModelT
+ * and EulerIntegratorT, but it is a simplified model of a simulation run:
+ * - the autopilot reads the true state, not the NavigationFilter estimate
+ * - autopilot, propulsion and dynamics all advance once per step of run(),
+ *   not in the rate groups of RateSchedule
+ * - the Moon is a sphere and the lander stays operational
+ *
+ * One run yields the touchdown velocity, the fuel used and their exact
+ * derivatives with respect to all SensitivityParameter values, which replaces
+ * 2N finite difference runs of this model.
+ *
+ * Touchdown is interpolated linearly within the last step. The event time
+ * therefore moves smoothly with the parameters, and the derivatives include
+ * the shift of the touchdown instant.
+ */
+class DescentSensitivity
+{
+public:
+    /**
+     * @brief Sets up the analysis for one lander configuration.
+     * @param environment Environment constants
+     * @param lander Lander configuration; engine 0 is the autopilot engine
+     * @param gains Autopilot tuning constants
+     * @throws std::runtime_error if the lander has no engine
+     */
+    DescentSensitivity(const EnvironmentConfig& environment, const customSpacecraft& lander, const DescentGains& gains = {});
+
+    /**
+     * @brief Flies the descent until touchdown or @p maxTime.
+     * @param dt Step size [s]
+     * @param maxTime Time limit [s]
+     * @return Touchdown values and their gradients
+     * @throws std::runtime_error if dt is not positive
+     */
+    DescentSensitivityResult run(double dt, double maxTime) const;
+
+private:
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    EnvironmentConfig environment_;         ///< Environment constants, copied so the analysis owns them
+    customSpacecraft lander_;               ///< Lander configuration
+    DescentGains gains_;                    ///< Autopilot tuning constants
+};
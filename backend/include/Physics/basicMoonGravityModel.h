@@ -4,7 +4,7 @@
 #include "environmentConfig.h"
 
 /**
- * @class BasicMoonGravityModel
+ * @class BasicMoonGravityModelT
  * @brief Simple physical model providing lunar gravity and thrust acceleration.
  *
  * This model computes the total acceleration of a spacecraft assuming:
@@ -14,8 +14,13 @@
  *
  * The gravitational field is modeled as an inverse-square radial field.
  * The class is stateless except for the referenced EnvironmentConfig.
+ *
+ * @tparam T Scalar type, instantiated for float, double and
+ *           SensitivityScalar in basicMoonGravityModel.cpp. The configuration
+ *           stays in double and is converted on use.
  */
-class BasicMoonGravityModel : public IPhysicsModel {
+template<typename T>
+class BasicMoonGravityModelT : public IPhysicsModelT<T> {
 public:
 
     /**
@@ -24,7 +29,7 @@ public:
      * @param cfg Reference to global environment configuration containing
      *            physical constants such as gravitational parameters.
      */
-    BasicMoonGravityModel(const EnvironmentConfig& cfg) : configData(cfg) {}
+    BasicMoonGravityModelT(const EnvironmentConfig& cfg) : configData(cfg) {}
 
     /**
      * @brief Computes total acceleration acting on the spacecraft.
@@ -40,7 +45,13 @@ public:
      * @param thrustDir  Normalized thrust direction vector.
      * @return Total acceleration vector in world space.
      */
-    Vector3 computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const override;
+    Vector3T<T> computeAcceleration(const Vector3T<T>& pos, const Vector3T<T>& vel, T mass, const Vector3T<T>& thrust) const override;
+
+    /**
+     * @brief The field is an inverse-square field of the moon.
+     * @return Lunar gravitational parameter [m³/s²]
+     */
+    std::optional<T> pointMassParameter() const override;
 
 private:
 
@@ -66,5 +77,10 @@ private:
      * @param pos Position vector relative to moon center.
      * @return Gravitational acceleration vector.
      */
-    Vector3 calcAccelerationAlignedToCenterOfMoon(const Vector3& pos) const;
+    Vector3T<T> calcAccelerationAlignedToCenterOfMoon(const Vector3T<T>& pos) const;
 };
+
+extern template class BasicMoonGravityModelT<double>;
+extern template class BasicMoonGravityModelT<float>;
+
+using BasicMoonGravityModel = BasicMoonGravityModelT<double>;
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Physics/iPhysicsModel.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @brief Tuning of the gravity cache.
+ */
+struct CachedGravityConfig
+{
+    double cellSize = 2000.0;       ///< [m] Edge length of the coarsest grid cells
+    int maxLevel = 4;               ///< [-] Maximum number of halvings during refinement
+    double tolerance = 1.0e-6;      ///< [m/s²] Accepted interpolation error at the cell center
+    std::size_t maxCells = 50000;   ///< Cells kept before the cache is flushed
+};
+
+/**
+ * @class CachedGravityModel
+ * @brief Caching wrapper that makes an expensive gravity field almost as cheap as a point mass.
+ *
+ * The wrapped model is split into the central point mass, which is evaluated
+ * exactly, and the residual (harmonics, mascons, ...), which varies slowly in
+ * space. The residual is sampled on the corners of cubic grid cells and
+ * trilinearly interpolated.
+ *
+ * Cells are created lazily when the trajectory enters them, so only the
+ * region around the flight path is ever computed. When a cell is created, the
+ * residual is also evaluated at its center; if the trilinear estimate there
+ * misses by more than the tolerance, the cell is split into eight children of
+ * half the size, down to @c maxLevel. Refinement decisions only depend on the
+ * cell itself, so the result is deterministic regardless of query order.
+ *
+ * Every thread keeps a hint to the last cell it used. Consecutive simulation
+ * steps almost always stay in the same cell, so the steady state query costs a
+ * point-mass evaluation plus one trilinear interpolation without locking.
+ *
+ * The wrapped model must be independent of velocity; thrust is added here as
+ * thrust / mass.
+ */
+class CachedGravityModel : public IPhysicsModel {
+public:
+
+    /**
+     * @brief Constructor
+     * @param inner Expensive gravity model to cache
+     * @param mu [m³/s²] Gravitational parameter of the central term of @p inner
+     * @param config Grid and refinement settings
+     */
+    CachedGravityModel(std::shared_ptr<const IPhysicsModel> inner, double mu, const CachedGravityConfig& config = CachedGravityConfig());
+
+    /**
+     * @brief Computes total acceleration acting on the spacecraft.
+     *
+     * @param pos        Current position vector relative to moon center [m].
+     * @param vel        Current velocity vector (unused).
+     * @param mass       Current spacecraft mass [kg].
+     * @param thrust     Current thrust force vector [N].
+     * @return Gravity plus thrust acceleration [m/s²].
+     */
+    Vector3 computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const override;
+
+    /**
+     * @brief Cached gravitational acceleration only.
+     * @param pos Position vector relative to moon center [m]
+     * @return Acceleration [m/s²]
+     */
+    Vector3 gravityAcceleration(const Vector3& pos) const;
+
+    /// @return Number of cached cells
+    std::size_t cellCount() const;
+
+    /// @brief Drops all cached cells
+    void clear();
+
+private:
+
+    /**
+     * @brief Address of a grid cell
+     */
+    struct CellKey
+    {
+        std::int32_t level = 0;
+        std::int32_t i = 0;
+        std::int32_t j = 0;
+        std::int32_t k = 0;
+
+        bool operator==(const CellKey& other) const
+        {
+            return level == other.level && i == other.i && j == other.j && k == other.k;
+        }
+    };
+
+    struct CellKeyHash
+    {
+        std::size_t operator()(const CellKey& key) const;
+    };
+
+    /**
+     * @brief Cached residual samples of one cell
+     */
+    struct Cell
+    {
+        Vector3 origin;                     ///< [m] Lower corner
+        double size = 0.0;                  ///< [m] Edge length
+        bool refined = false;               ///< Too coarse, use the children instead
+        std::array<Vector3, 8> corners;     ///< [m/s²] Residual at the corners, index = x + 2y + 4z
+
+        bool contains(const Vector3& p) const
+        {
+            return p.x >= origin.x && p.y >= origin.y && p.z >= origin.z
+                && p.x < origin.x + size && p.y < origin.y + size && p.z < origin.z + size;
+        }
+    };
+
+    using CellPtr = std::shared_ptr<const Cell>;
+
+    /**
+     * @brief Last cell used by a thread
+     */
+    struct Hint
+    {
+        std::uint64_t owner = 0;
+        CellPtr cell;
+    };
+
+    //********************************************
+    //*********  METHODS  ************************
+    //********************************************
+
+    /// @return Finest existing leaf cell containing @p pos, building cells as needed
+    const Cell& leafAt(const Vector3& pos) const;
+
+    /// @return Cell for @p key, built on a miss
+    CellPtr findOrBuild(const CellKey& key) const;
+
+    /// @return New cell with sampled corners and refinement decision
+    CellPtr buildCell(const CellKey& key) const;
+
+    /// @return [m/s²] Exact residual of the wrapped model
+    Vector3 residual(const Vector3& pos) const;
+
+    /// @return [m/s²] Point mass acceleration
+    Vector3 pointMass(const Vector3& pos) const;
+
+    /// @return [m/s²] Trilinear interpolation of the corners, local coordinates in [0, 1]
+    static Vector3 interpolate(const Cell& cell, double fx, double fy, double fz);
+
+    //********************************************
+    //*********  MEMBERS  ************************
+    //********************************************
+
+    std::shared_ptr<const IPhysicsModel> inner_;    ///< Wrapped expensive model
+    double mu_;                                     ///< [m³/s²] Central gravitational parameter
+    CachedGravityConfig config_;
+    std::uint64_t id_;                              ///< Unique id for the per-thread hint
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<CellKey, CellPtr, CellKeyHash> cells_;
+
+    static thread_local Hint hint_;
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "vector3.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @class ChebyshevEphemeris
+ * @brief Position of a body from piecewise Chebyshev polynomials.
+ *
+ * The ephemeris is a sequence of consecutive time segments. Each segment
+ * holds Chebyshev coefficients for x, y and z, so a position is one short
+ * Clenshaw recurrence per axis instead of an orbit solution. Positions are
+ * relative to the moon center [m], times are simulation seconds.
+ *
+ * The tables are generated offline once with @ref fit and @ref save (from a
+ * high-precision ephemeris or any other position function) and loaded at
+ * runtime.
+ *
+ * File format (text):
+ * @code
+ * # comment
+ * GM 3.986004418e14
+ * COEFFICIENTS 12
+ * t0 t1 cx[0..n-1] cy[0..n-1] cz[0..n-1]
+ * ...
+ * @endcode
+ * with one segment per line, sorted by time and without gaps.
+ *
+ * Segment lookup starts at the segment used last (shared atomic hint), since
+ * consecutive queries almost always fall into the same segment.
+ */
+class ChebyshevEphemeris
+{
+public:
+    /**
+     * @brief One time segment
+     */
+    struct Segment
+    {
+        double t0 = 0.0;                ///< [s] Segment start
+        double t1 = 0.0;                ///< [s] Segment end
+        std::vector<double> cx;         ///< [m] Coefficients of x
+        std::vector<double> cy;         ///< [m] Coefficients of y
+        std::vector<double> cz;         ///< [m] Coefficients of z
+    };
+
+    ChebyshevEphemeris() = default;
+
+    /**
+     * @brief Loads an ephemeris file.
+     * @param path Path to the coefficient table
+     * @throws std::runtime_error If the file cannot be read or is malformed
+     */
+    explicit ChebyshevEphemeris(const std::string& path);
+
+    ChebyshevEphemeris(const ChebyshevEphemeris& other);
+    ChebyshevEphemeris& operator=(const ChebyshevEphemeris& other);
+
+    /**
+     * @brief Builds an ephemeris by sampling a position function at Chebyshev nodes.
+     *
+     * @param position Position of the body relative to the moon [m] at time t [s]
+     * @param gm [m³/s²] Gravitational parameter of the body
+     * @param t0 [s] Start of the covered interval
+     * @param t1 [s] End of the covered interval
+     * @param segmentLength [s] Length of one segment
+     * @param coefficients Number of coefficients per axis
+     */
+    static ChebyshevEphemeris fit(const std::function<Vector3(double)>& position, double gm,
+                                  double t0, double t1, double segmentLength, int coefficients);
+
+    /**
+     * @brief Writes the ephemeris in the file format described above.
+     * @throws std::runtime_error If the file cannot be written
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Position of the body at time @p t.
+     *
+     * Times outside the covered interval are clamped to the first or last segment.
+     * @param t Simulation time [s]
+     * @return Position relative to moon center [m]
+     */
+    Vector3 position(double t) const;
+
+    /// @return [m³/s²] Gravitational parameter of the body
+    double gm() const { return gm_; }
+
+    /// @return [s] Start of the covered interval
+    double startTime() const;
+
+    /// @return [s] End of the covered interval
+    double endTime() const;
+
+private:
+    /// @return Index of the segment containing @p t
+    std::size_t findSegment(double t) const;
+
+    /// @return Chebyshev series at τ ∈ [-1, 1]
+    static double clenshaw(const std::vector<double>& c, double tau);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    double gm_ = 0.0;                           ///< [m³/s²]
+    std::vector<Segment> segments_;
+    mutable std::atomic<std::size_t> hint_{0};  ///< Segment used last
+};
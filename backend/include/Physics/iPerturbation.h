@@ -0,0 +1,32 @@
+#pragma once
+
+#include "vector3.h"
+
+/**
+ * @class IPerturbation
+ * @brief Interface for additional, time dependent accelerations.
+ *
+ * Perturbations are small accelerations that are added on top of the
+ * active IPhysicsModel by @ref physics::computeAcc, e.g. the tidal pull of
+ * Earth and Sun. Unlike the main model they may depend on simulation time.
+ *
+ * Implementations must be thread safe, since landers stepped concurrently
+ * share them.
+ */
+class IPerturbation {
+public:
+
+    /**
+     * @brief Virtual destructor to ensure proper cleanup of derived perturbations.
+     */
+    virtual ~IPerturbation() = default;
+
+    /**
+     * @brief Computes the perturbing acceleration.
+     *
+     * @param pos Position vector relative to moon center [m]
+     * @param t   Simulation time [s]
+     * @return Acceleration [m/s²]
+     */
+    virtual Vector3 perturbingAcceleration(const Vector3& pos, double t) const = 0;
+};
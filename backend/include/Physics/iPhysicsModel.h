@@ -1,8 +1,10 @@
 #pragma once
 #include "vector3.h"
 
+#include <optional>
+
 /**
- * @class IPhysicsModel
+ * @class IPhysicsModelT
  * @brief Interface for physical acceleration models.
  *
  * IPhysicsModel defines the contract for all physics models that compute
@@ -12,14 +14,18 @@
  * Implementations may include gravity models, atmospheric drag,
  * multi-body gravity, or simplified test models. The interface is
  * intentionally independent of any numerical integration scheme.
+ *
+ * @tparam T Scalar type (float or double). The simulation uses the double
+ *           alias @ref IPhysicsModel.
  */
-class IPhysicsModel {
+template<typename T>
+class IPhysicsModelT {
 public:
 
     /**
      * @brief Virtual destructor to ensure proper cleanup of derived models.
      */
-    virtual ~IPhysicsModel() = default;
+    virtual ~IPhysicsModelT() = default;
 
     /**
      * @brief Computes the total acceleration acting on an object.
@@ -35,5 +41,18 @@ public:
      * @param thrustDir Normalized thrust direction vector.
      * @return Resulting acceleration vector.
      */
-    virtual Vector3 computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const = 0;
+    virtual Vector3T<T> computeAcceleration(const Vector3T<T>& pos, const Vector3T<T>& vel, T mass, const Vector3T<T>& thrust) const = 0;
+
+    /**
+     * @brief Gravitational parameter if the field is a pure point mass.
+     *
+     * Unpowered flight in a point-mass field has a closed-form solution
+     * (see KeplerPropagator). Models with any non-central term must keep
+     * the default.
+     *
+     * @return μ [m³/s²], or std::nullopt if the field is not a point mass.
+     */
+    virtual std::optional<T> pointMassParameter() const { return std::nullopt; }
 };
+
+using IPhysicsModel = IPhysicsModelT<double>;
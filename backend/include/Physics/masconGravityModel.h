@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Physics/iPhysicsModel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Point mass concentration
+ */
+struct Mascon
+{
+    Vector3 position;   ///< [m] Position relative to moon center
+    double gm = 0.0;    ///< [m³/s²] Gravitational parameter, negative for mass deficits
+};
+
+/**
+ * @class MasconGravityModel
+ * @brief Lunar gravity as central point mass plus a field of mass concentrations.
+ *
+ * Thousands of mascons reproduce regional anomalies (e.g. over a landing
+ * site) without a high degree harmonic expansion. Summing all of them for
+ * every query is O(N), so the mascons are organized in an octree and
+ * evaluated Barnes–Hut style:
+ *
+ * - A node that is small compared to its distance (size / distance < θ) is
+ *   replaced by a monopole and dipole expansion about its center. The
+ *   center is weighted by |GM|, since anomalies are positive and negative
+ *   and the ordinary center of mass may lie far outside the node.
+ * - Leaves that are too close are summed exactly. Leaf mascons are stored
+ *   contiguously as structure of arrays, so this near-field loop is
+ *   vectorized (omp simd).
+ *
+ * Lowering θ trades speed for accuracy; θ = 0 is the exact sum.
+ *
+ * The mascon file is a text table with one mascon per line:
+ * x, y, z [m], GM [m³/s²], separated by commas or whitespace. Lines
+ * starting with '#' are ignored.
+ *
+ * The model is immutable after construction and may be shared between
+ * landers stepped concurrently.
+ */
+class MasconGravityModel : public IPhysicsModel {
+public:
+
+    /**
+     * @brief Loads mascons from a file and builds the octree.
+     * @param path Path to the mascon table
+     * @param mu [m³/s²] Gravitational parameter of the central point mass
+     * @param theta [-] Opening angle of the far-field approximation
+     * @throws std::runtime_error If the file cannot be read
+     */
+    MasconGravityModel(const std::string& path, double mu, double theta = 0.5);
+
+    /**
+     * @brief Builds the octree from mascons given in memory.
+     * @param mascons Mass concentrations
+     * @param mu [m³/s²] Gravitational parameter of the central point mass
+     * @param theta [-] Opening angle of the far-field approximation
+     */
+    MasconGravityModel(const std::vector<Mascon>& mascons, double mu, double theta = 0.5);
+
+    /**
+     * @brief Computes total acceleration acting on the spacecraft.
+     *
+     * @param pos        Current position vector relative to moon center [m].
+     * @param vel        Current velocity vector (unused).
+     * @param mass       Current spacecraft mass [kg].
+     * @param thrust     Current thrust force vector [N].
+     * @return Gravity plus thrust acceleration [m/s²].
+     */
+    Vector3 computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const override;
+
+    /**
+     * @brief Gravitational acceleration using the octree approximation.
+     * @param pos Position vector relative to moon center [m]
+     * @return Acceleration [m/s²]
+     */
+    Vector3 gravityAcceleration(const Vector3& pos) const;
+
+    /**
+     * @brief Exact gravitational acceleration by direct summation, for validation.
+     * @param pos Position vector relative to moon center [m]
+     * @return Acceleration [m/s²]
+     */
+    Vector3 directAcceleration(const Vector3& pos) const;
+
+    /// @return Number of mascons
+    std::size_t masconCount() const { return gm_.size(); }
+
+    /// @return Number of octree nodes
+    std::size_t nodeCount() const { return nodes_.size(); }
+
+private:
+
+    /**
+     * @brief Octree node with its far-field expansion
+     */
+    struct Node
+    {
+        Vector3 center;             ///< [m] |GM| weighted center, expansion point
+        Vector3 dipole;             ///< [m⁴/s²] Σ GM·(p - center)
+        double monopole = 0.0;      ///< [m³/s²] Σ GM
+        double size = 0.0;          ///< [m] Edge length of the node box
+        std::int32_t firstChild = -1;   ///< Index of the first child, -1 for leaves
+        std::uint32_t childCount = 0;   ///< Children are stored consecutively
+        std::uint32_t begin = 0;        ///< First mascon of the node
+        std::uint32_t end = 0;          ///< One past the last mascon of the node
+    };
+
+    //********************************************
+    //*********  METHODS  ************************
+    //********************************************
+
+    /**
+     * @brief Reads a mascon table
+     */
+    static std::vector<Mascon> loadMascons(const std::string& path);
+
+    /**
+     * @brief Builds the octree and the SoA arrays
+     */
+    void build(std::vector<Mascon> mascons);
+
+    /**
+     * @brief Recursively fills node @p nodeIndex from mascons [begin, end)
+     */
+    void buildNode(std::vector<Mascon>& mascons, std::uint32_t nodeIndex, std::uint32_t begin, std::uint32_t end,
+                   const Vector3& boxCenter, double boxSize, int depth);
+
+    /**
+     * @brief Exact sum over mascons [begin, end)
+     */
+    Vector3 directSum(const Vector3& pos, std::uint32_t begin, std::uint32_t end) const;
+
+    //********************************************
+    //*********  MEMBERS  ************************
+    //********************************************
+
+    double mu_;                     ///< [m³/s²] Central gravitational parameter
+    double theta_;                  ///< [-] Opening angle
+
+    std::vector<Node> nodes_;       ///< Node 0 is the root
+
+    // Mascons in octree order
+    std::vector<double> x_;         ///< [m]
+    std::vector<double> y_;         ///< [m]
+    std::vector<double> z_;         ///< [m]
+    std::vector<double> gm_;        ///< [m³/s²]
+};
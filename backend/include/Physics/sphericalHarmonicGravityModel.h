@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Physics/iPhysicsModel.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @class SphericalHarmonicGravityModel
+ * @brief Lunar gravity field from a truncated spherical-harmonic expansion.
+ *
+ * The potential is
+ *   U = GM/R · Σₙ Σₘ (C̄ₙₘ V̄ₙₘ + S̄ₙₘ W̄ₙₘ)
+ * with fully normalized coefficients C̄, S̄ and the normalized Cunningham
+ * functions V̄, W̄. The acceleration follows directly from V̄, W̄ of one degree
+ * higher (Cunningham / Montenbruck & Gill), without spherical coordinates, so
+ * the evaluation has no singularity at the poles.
+ *
+ * Performance:
+ * - All recursion and gradient factors depending only on (n, m) are
+ *   precomputed in the constructor.
+ * - V̄ and W̄ carry cos(mλ)·Pₙₘ and sin(mλ)·Pₙₘ, so the longitude terms are
+ *   built by the recursion itself; no trigonometric function is evaluated.
+ * - Both the recursion and the gradient sum run over order m in contiguous
+ *   memory and are vectorized (omp simd).
+ * A degree 50 field costs a few microseconds per evaluation.
+ *
+ * Coefficients are read from a PDS SHADR table (as distributed for the GRAIL
+ * and LP gravity models). The field is evaluated in the simulation frame,
+ * which is treated as Moon-fixed: the Moon rotates by about 0.5° per hour,
+ * which is negligible over a descent.
+ *
+ * The model is stateless; scratch memory is per thread, so it may be shared
+ * between landers stepped concurrently.
+ */
+class SphericalHarmonicGravityModel : public IPhysicsModel {
+public:
+
+    /**
+     * @brief Loads the coefficients and precomputes the recursions.
+     *
+     * @param path Path to a SHADR coefficient table
+     * @param maxDegree Truncation degree and order, 0 = everything in the file
+     * @throws std::runtime_error If the file cannot be read or parsed
+     */
+    SphericalHarmonicGravityModel(const std::string& path, int maxDegree = 0);
+
+    /**
+     * @brief Computes total acceleration acting on the spacecraft.
+     *
+     * @param pos        Current position vector relative to moon center [m].
+     * @param vel        Current velocity vector (unused).
+     * @param mass       Current spacecraft mass [kg].
+     * @param thrust     Current thrust force vector [N].
+     * @return Gravity plus thrust acceleration [m/s²].
+     */
+    Vector3 computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const override;
+
+    /**
+     * @brief Computes the gravitational acceleration only.
+     * @param pos Position vector relative to moon center [m]
+     * @return Acceleration [m/s²]
+     */
+    Vector3 gravityAcceleration(const Vector3& pos) const;
+
+    /// @return Truncation degree
+    int degree() const { return degree_; }
+
+    /// @return [m] Reference radius of the coefficients
+    double referenceRadius() const { return radius_; }
+
+    /// @return [m³/s²] Gravitational parameter of the coefficients
+    double gm() const { return gm_; }
+
+private:
+
+    //********************************************
+    //*********  METHODS  ************************
+    //********************************************
+
+    /**
+     * @brief Reads a PDS SHADR coefficient table.
+     */
+    void loadShadr(const std::string& path, int maxDegree);
+
+    /**
+     * @brief Precomputes recursion and gradient factors.
+     */
+    void precompute();
+
+    /// @return Index of (n, m) in triangular storage
+    static std::size_t index(int n, int m) { return static_cast<std::size_t>(n) * (n + 1) / 2 + m; }
+
+    //********************************************
+    //*********  MEMBERS  ************************
+    //********************************************
+
+    int degree_ = 0;                ///< [-] Truncation degree N
+    double radius_ = 0.0;           ///< [m] Reference radius R
+    double gm_ = 0.0;               ///< [m³/s²] GM
+
+    // Coefficients, degree 0..N
+    std::vector<double> C_;         ///< Normalized cosine coefficients
+    std::vector<double> S_;         ///< Normalized sine coefficients
+
+    // Recursion factors, degree 0..N+1
+    std::vector<double> alpha_;     ///< Vertical recursion, V̄ₙ₋₁,ₘ term
+    std::vector<double> beta_;      ///< Vertical recursion, V̄ₙ₋₂,ₘ term
+    std::vector<double> gamma_;     ///< Diagonal recursion per order m
+
+    // Gradient factors, degree 0..N
+    std::vector<double> zFactor_;   ///< z term, uses V̄ₙ₊₁,ₘ
+    std::vector<double> upFactor_;  ///< x/y term using V̄ₙ₊₁,ₘ₊₁
+    std::vector<double> downFactor_;///< x/y term using V̄ₙ₊₁,ₘ₋₁
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Physics/iPerturbation.h"
+#include "Physics/chebyshevEphemeris.h"
+
+#include <vector>
+
+/**
+ * @class ThirdBodyPerturbation
+ * @brief Tidal acceleration of distant bodies (Earth, Sun) on the spacecraft.
+ *
+ * The simulation frame is centered on the moon, which itself is accelerated
+ * by the same bodies. The relevant acceleration is therefore the difference
+ * between the pull on the spacecraft and the pull on the moon:
+ *
+ *   a = Σ μ_b · ( (s_b - r) / |s_b - r|³ - s_b / |s_b|³ )
+ *
+ * with s_b the body position from its ChebyshevEphemeris.
+ */
+class ThirdBodyPerturbation : public IPerturbation {
+public:
+
+    /**
+     * @brief Constructor
+     * @param epochOffset [s] Ephemeris time corresponding to simulation time 0
+     */
+    explicit ThirdBodyPerturbation(double epochOffset = 0.0) : epochOffset_(epochOffset) {}
+
+    /**
+     * @brief Adds a perturbing body.
+     * @param ephemeris Position and GM of the body
+     */
+    void addBody(const ChebyshevEphemeris& ephemeris);
+
+    /**
+     * @brief Computes the tidal acceleration of all bodies.
+     *
+     * @param pos Position vector relative to moon center [m]
+     * @param t   Simulation time [s]
+     * @return Acceleration [m/s²]
+     */
+    Vector3 perturbingAcceleration(const Vector3& pos, double t) const override;
+
+private:
+
+    //********************************************
+    //*********  MEMBERS  ************************
+    //********************************************
+
+    double epochOffset_;                        ///< [s] Ephemeris time at simulation time 0
+    std::vector<ChebyshevEphemeris> bodies_;    ///< Perturbing bodies
+};
@@ -1,6 +1,34 @@
 #pragma once
 
 #include "vector3.h"
+#include "philox.h"
+
+/**
+ * @brief Ground truth seen by the sensors at one instant.
+ *
+ * Filled from the simulation state (see SensorSuite::truthOf). All vectors
+ * are in the body frame, because that is where the instruments are mounted.
+ */
+struct SensorTruth
+{
+    double time = 0.0;                          ///< [s] Simulation time
+    Vector3 B_specificForce{0.0, 0.0, 0.0};     ///< [m/s²] Non-gravitational acceleration (thrust, ground reaction)
+    Vector3 B_angularVelocity{0.0, 0.0, 0.0};   ///< [rad/s] Body rate
+    Vector3 B_velocity{0.0, 0.0, 0.0};          ///< [m/s] Velocity relative to the surface
+    Vector3 B_down{0.0, 0.0, -1.0};             ///< [-] Unit local vertical pointing down
+    double altitude = 0.0;                      ///< [m] Height above the terrain
+};
+
+/**
+ * @brief Dynamic state of a sensor as stored in a simulation checkpoint.
+ */
+struct SensorCheckpoint
+{
+    NoiseStreamState noise;                     ///< Position in the noise stream
+    Vector3 bias{0.0, 0.0, 0.0};                ///< Current bias, unused by sensors without bias
+    Vector3 reading{0.0, 0.0, 0.0};             ///< Last measurement
+    bool valid = false;                         ///< Validity of the last measurement
+};
 
 /**
  * @class ISensor
@@ -15,6 +43,10 @@
  * gyroscopes, fuel gauges, or other cockpit instruments. Sensor models
  * may optionally introduce noise, bias, filtering or delay to simulate
  * real-world measurement behavior.
+ *
+ * Each implementation keeps its last measurement and exposes it through a
+ * typed getter. Noisy sensors draw from their own @ref NoiseStream, so a run
+ * is reproducible from its seed.
  */
 class ISensor {
 public:
@@ -25,15 +57,21 @@ public:
     virtual ~ISensor() = default;
 
     /**
-     * @brief Computes the experienced g-load from acceleration vectors.
-     *
-     * The g-load represents the proper acceleration measured by an onboard
-     * accelerometer and excludes gravitational acceleration. The result is
-     * normalized to Earth gravity (g₀ ≈ 9.80665 m/s²).
-     *
-     * @param totalAcceleration   Total acceleration acting on the spacecraft.
-     * @param gravityAcceleration Gravitational acceleration vector.
-     * @return Scalar g-load value in multiples of Earth gravity.
+     * @brief Takes a measurement.
+     * @param truth True state at the sampling instant
+     * @param dt Time since the previous sample [s], drives noise density and bias drift where the sensor model has them
+     */
+    virtual void sample(const SensorTruth& truth, double dt) = 0;
+
+    /**
+     * @brief Captures the dynamic sensor state (noise position, bias, last reading)
+     * @return Sensor checkpoint
+     */
+    virtual SensorCheckpoint captureCheckpoint() const = 0;
+
+    /**
+     * @brief Restores the dynamic sensor state captured by captureCheckpoint
+     * @param checkpoint Sensor checkpoint
      */
-    virtual double computeGLoad(const Vector3& totalAcceleration, const Vector3& gravityAcceleration, bool isLanded) const = 0;
+    virtual void restoreCheckpoint(const SensorCheckpoint& checkpoint) = 0;
 };
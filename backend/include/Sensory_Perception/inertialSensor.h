@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Sensory_Perception/iSensor.h"
+
+#include <cstdint>
+
+/**
+ * @brief Error model of a three-axis inertial sensor.
+ *
+ * The usual datasheet quantities: white noise given as a density, a turn-on
+ * bias that is constant over a run, and a bias random walk.
+ */
+struct InertialNoise
+{
+    double noiseDensity = 0.0;      ///< White noise density [unit/√Hz], standard deviation per sample is noiseDensity/√dt
+    double biasSigma = 0.0;         ///< Standard deviation of the turn-on bias [unit]
+    double biasRandomWalk = 0.0;    ///< Bias drift [unit/√s]
+};
+
+/**
+ * @class InertialSensor
+ * @brief Three-axis inertial sensor with white noise, bias and bias drift.
+ *
+ * measurement = truth + bias + noiseDensity/√dt · n,  bias += biasRandomWalk·√dt · n'
+ *
+ * with independent standard normal n, n' per axis from the sensor's own
+ * @ref NoiseStream. The turn-on bias is drawn from the same stream at
+ * construction, so it is part of the reproducible run.
+ *
+ * Derived classes only select the measured quantity.
+ */
+class InertialSensor : public ISensor
+{
+public:
+    /**
+     * @brief Constructor
+     * @param noise Error model
+     * @param seed Seed of the run
+     * @param stream Noise stream id of this sensor
+     */
+    InertialSensor(const InertialNoise& noise, std::uint64_t seed, std::uint64_t stream);
+
+    /**
+     * @brief Takes a measurement; without elapsed time (dt <= 0) the last one is kept.
+     * @param truth True state at the sampling instant
+     * @param dt Time since the previous sample [s]
+     */
+    void sample(const SensorTruth& truth, double dt) override;
+
+    /// @return Last measurement in the body frame
+    const Vector3& getReading() const;
+
+    /// @return Current bias in the body frame, for analysis only
+    const Vector3& getBias() const;
+
+    /// @return True once a measurement was taken
+    bool isValid() const;
+
+    SensorCheckpoint captureCheckpoint() const override;
+
+    void restoreCheckpoint(const SensorCheckpoint& checkpoint) override;
+
+protected:
+    /**
+     * @brief Quantity measured by the sensor
+     * @param truth True state
+     * @return True value in the body frame
+     */
+    virtual Vector3 truthValue(const SensorTruth& truth) const = 0;
+
+private:
+    /// @return Three independent standard normal samples
+    Vector3 gaussianVector();
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    InertialNoise spec_;                    ///< Error model
+    NoiseStream noise_;                     ///< Noise source of this sensor
+    Vector3 bias_{0.0, 0.0, 0.0};           ///< Current bias
+    Vector3 reading_{0.0, 0.0, 0.0};        ///< Last measurement
+    bool valid_ = false;                    ///< A measurement was taken
+};
+
+/**
+ * @class Accelerometer
+ * @brief Measures the specific force in the body frame [m/s²].
+ */
+class Accelerometer : public InertialSensor
+{
+public:
+    /// Error model of a navigation-grade MEMS accelerometer
+    static constexpr InertialNoise DEFAULT_NOISE{8e-4, 5e-3, 1e-4};
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param stream Noise stream id of this sensor
+     * @param noise Error model [m/s²/√Hz, m/s², m/s²/√s]
+     */
+    Accelerometer(std::uint64_t seed, std::uint64_t stream, const InertialNoise& noise = DEFAULT_NOISE)
+        : InertialSensor(noise, seed, stream) {}
+
+protected:
+    Vector3 truthValue(const SensorTruth& truth) const override { return truth.B_specificForce; }
+};
+
+/**
+ * @class Gyroscope
+ * @brief Measures the angular velocity in the body frame [rad/s].
+ */
+class Gyroscope : public InertialSensor
+{
+public:
+    /// Error model of a navigation-grade gyroscope (about 0.1 °/√h, 1 °/h bias)
+    static constexpr InertialNoise DEFAULT_NOISE{2.9e-5, 4.8e-6, 1e-7};
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param stream Noise stream id of this sensor
+     * @param noise Error model [rad/s/√Hz, rad/s, rad/s/√s]
+     */
+    Gyroscope(std::uint64_t seed, std::uint64_t stream, const InertialNoise& noise = DEFAULT_NOISE)
+        : InertialSensor(noise, seed, stream) {}
+
+protected:
+    Vector3 truthValue(const SensorTruth& truth) const override { return truth.B_angularVelocity; }
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Sensory_Perception/iSensor.h"
+
+#include <cstdint>
+
+/**
+ * @class RadarAltimeter
+ * @brief Range to the ground along the body -z axis.
+ *
+ * The beam points out of the bottom of the lander. Over locally flat terrain
+ * the slant range is altitude / cos(tilt), where tilt is the angle between
+ * the beam and the local vertical. The measurement noise grows with range:
+ * σ = rangeNoise + rangeNoiseScale · range.
+ *
+ * Without a ground return, i.e. beyond @ref maxRange_ or beyond @ref maxTilt_,
+ * the measurement is invalid and the last range is kept.
+ */
+class RadarAltimeter : public ISensor
+{
+public:
+    static constexpr double DEFAULT_MAX_RANGE = 10000.0;            ///< [m]
+    static constexpr double DEFAULT_MAX_TILT = 0.785398163397448;   ///< [rad] 45°
+    static constexpr double DEFAULT_RANGE_NOISE = 0.05;             ///< [m]
+    static constexpr double DEFAULT_RANGE_NOISE_SCALE = 0.005;      ///< [-]
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param stream Noise stream id of this sensor
+     * @param maxRange Largest measurable slant range [m]
+     * @param maxTilt Largest beam angle from the local vertical [rad]
+     * @param rangeNoise Constant part of the noise standard deviation [m]
+     * @param rangeNoiseScale Part of the noise standard deviation proportional to range [-]
+     */
+    RadarAltimeter(std::uint64_t seed, std::uint64_t stream,
+                   double maxRange = DEFAULT_MAX_RANGE, double maxTilt = DEFAULT_MAX_TILT,
+                   double rangeNoise = DEFAULT_RANGE_NOISE, double rangeNoiseScale = DEFAULT_RANGE_NOISE_SCALE);
+
+    /**
+     * @brief Takes a measurement.
+     *
+     * The noise is specified per sample, so the result does not depend on the
+     * sample interval; @p dt is ignored.
+     *
+     * @param truth True state at the sampling instant
+     */
+    void sample(const SensorTruth& truth, double dt) override;
+
+    /// @return Last slant range [m]
+    double getRange() const;
+
+    /// @return True if the last sample had a ground return
+    bool isValid() const;
+
+    SensorCheckpoint captureCheckpoint() const override;
+
+    void restoreCheckpoint(const SensorCheckpoint& checkpoint) override;
+
+private:
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    NoiseStream noise_;             ///< Noise source of this sensor
+    double maxRange_;               ///< [m] Largest measurable slant range
+    double minCosTilt_;             ///< [-] Cosine of the largest beam angle
+    double rangeNoise_;             ///< [m] Constant noise standard deviation
+    double rangeNoiseScale_;        ///< [-] Range-proportional noise standard deviation
+    double range_ = 0.0;            ///< [m] Last slant range
+    bool valid_ = false;            ///< Last sample had a ground return
+};
@@ -5,17 +5,15 @@
 
 /**
  * @class SensorModel
- * @brief Abstract base class for spacecraft sensor model implementations.
+ * @brief Ideal G-load meter of the cockpit.
  *
- * SensorModel extends the generic ISensor interface and represents a
- * configurable collection of onboard measurement algorithms. Implementations
- * derive observable quantities from the physical simulation state without
- * modifying it.
+ * SensorModel implements the ISensor interface for the G-load display.
+ * It derives the proper acceleration from the physical simulation state
+ * without modifying it and without noise.
  *
- * A SensorModel may aggregate multiple virtual instruments such as
- * accelerometers, altimeters, gyroscopes or fuel gauges. Concrete subclasses
- * can introduce effects like noise, bias, filtering or delay to emulate
- * realistic hardware behavior.
+ * Noisy navigation sensors (accelerometer, gyroscope, radar altimeter,
+ * velocimeter) are separate ISensor implementations collected in
+ * @ref SensorSuite.
  *
  * This layer forms the perception boundary between the physical simulation
  * (ground truth) and the spacecraft’s instrumentation or telemetry output.
@@ -42,11 +40,27 @@ public:
      * @param gravityAcceleration Gravitational acceleration vector.
      * @return Scalar g-load value in multiples of Earth gravity.
      */
-    double computeGLoad(const Vector3& totalAcceleration, const Vector3& gravityAcceleration, bool isLanded) const override;
+    double computeGLoad(const Vector3& totalAcceleration, const Vector3& gravityAcceleration, bool isLanded) const;
+
+    /**
+     * @brief G-load from the specific force of the truth state.
+     * @param truth True state at the sampling instant
+     * @param dt Unused, the meter is ideal
+     */
+    void sample(const SensorTruth& truth, double dt) override;
+
+    /// @return Last sampled G-load in multiples of Earth gravity
+    double getGLoad() const;
+
+    SensorCheckpoint captureCheckpoint() const override;
+
+    void restoreCheckpoint(const SensorCheckpoint& checkpoint) override;
 
 private:
     /**
      * @brief Reference to environment configuration containing constants.
      */
     const EnvironmentConfig& configData;
+
+    double gLoad_ = 0.0;    ///< [g] Last sampled G-load
 };
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Sensory_Perception/inertialSensor.h"
+#include "Sensory_Perception/radarAltimeter.h"
+#include "Sensory_Perception/velocimeter.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class spacecraft;
+
+/**
+ * @brief Latest measurements of a @ref SensorSuite.
+ *
+ * The *Updated flags mark measurements taken in the last call of
+ * SensorSuite::sample, so a consumer can process each measurement once.
+ */
+struct SensorReadings
+{
+    Vector3 B_specificForce{0.0, 0.0, 0.0};     ///< [m/s²] Accelerometer
+    Vector3 B_angularVelocity{0.0, 0.0, 0.0};   ///< [rad/s] Gyroscope
+    double radarRange = 0.0;                    ///< [m] Radar altimeter slant range
+    Vector3 B_velocity{0.0, 0.0, 0.0};          ///< [m/s] Velocimeter
+
+    bool imuUpdated = false;                    ///< Accelerometer and gyroscope sampled
+    bool radarUpdated = false;                  ///< Radar altimeter sampled with a ground return
+    bool velocimeterUpdated = false;            ///< Velocimeter sampled with a ground return
+};
+
+/**
+ * @brief Dynamic state of a @ref SensorSuite as stored in a simulation checkpoint.
+ */
+struct SensorSuiteCheckpoint
+{
+    SensorCheckpoint accelerometer;
+    SensorCheckpoint gyroscope;
+    SensorCheckpoint radarAltimeter;
+    SensorCheckpoint velocimeter;
+    double radarElapsed = 0.0;                  ///< [s] Time since the last radar sample was due
+    double velocimeterElapsed = 0.0;            ///< [s] Time since the last velocimeter sample was due
+    SensorReadings readings;
+};
+
+/**
+ * @class SensorSuite
+ * @brief Navigation sensors of one lander.
+ *
+ * Bundles accelerometer, gyroscope, radar altimeter and velocimeter. The IMU is
+ * sampled every step; radar and velocimeter at their own, lower rates.
+ *
+ * Every sensor draws from its own noise stream with the id
+ * landerId · @ref STREAMS_PER_LANDER + channel. The noise of a lander is
+ * therefore a function of (seed, landerId) only, independent of how many
+ * landers exist and of which thread steps them.
+ */
+class SensorSuite
+{
+public:
+    /// Stream ids reserved per lander
+    static constexpr std::uint64_t STREAMS_PER_LANDER = 16;
+
+    static constexpr double RADAR_PERIOD = 0.05;         ///< [s] 20 Hz
+    static constexpr double VELOCIMETER_PERIOD = 0.1;    ///< [s] 10 Hz
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param landerId Id of the lander within the run
+     */
+    SensorSuite(std::uint64_t seed, std::size_t landerId);
+
+    /**
+     * @brief Samples the sensors that are due
+     * @param craft Spacecraft providing the true state
+     * @param dt Time since the previous call [s]
+     */
+    void sample(const spacecraft& craft, double dt);
+
+    /**
+     * @brief Samples the sensors that are due
+     * @param truth True state
+     * @param dt Time since the previous call [s]
+     */
+    void sample(const SensorTruth& truth, double dt);
+
+    /// @return Latest measurements
+    const SensorReadings& readings() const;
+
+    const Accelerometer& accelerometer() const;
+    const Gyroscope& gyroscope() const;
+    const RadarAltimeter& radarAltimeter() const;
+    const Velocimeter& velocimeter() const;
+
+    SensorSuiteCheckpoint captureCheckpoint() const;
+
+    void restoreCheckpoint(const SensorSuiteCheckpoint& checkpoint);
+
+    /**
+     * @brief True state seen by the sensors of a spacecraft
+     * @param craft Spacecraft
+     * @return Body-frame truth
+     */
+    static SensorTruth truthOf(const spacecraft& craft);
+
+private:
+    /// Stream channel of each sensor within a lander
+    enum Channel : std::uint64_t { AccelerometerChannel, GyroscopeChannel, RadarChannel, VelocimeterChannel };
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    Accelerometer accelerometer_;
+    Gyroscope gyroscope_;
+    RadarAltimeter radarAltimeter_;
+    Velocimeter velocimeter_;
+
+    double radarElapsed_ = 0.0;             ///< [s] Time since the last radar sample was due
+    double velocimeterElapsed_ = 0.0;       ///< [s] Time since the last velocimeter sample was due
+    SensorReadings readings_;               ///< Latest measurements
+};
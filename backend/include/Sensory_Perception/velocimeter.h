@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Sensory_Perception/iSensor.h"
+
+#include <cstdint>
+
+/**
+ * @class Velocimeter
+ * @brief Doppler velocimeter measuring the velocity over ground in the body frame.
+ *
+ * Each axis gets independent noise with σ = velocityNoise + velocityNoiseScale · |v|.
+ * Above @ref maxAltitude_ the beams have no ground return and the measurement
+ * is invalid; the last velocity is kept.
+ */
+class Velocimeter : public ISensor
+{
+public:
+    static constexpr double DEFAULT_MAX_ALTITUDE = 5000.0;          ///< [m]
+    static constexpr double DEFAULT_VELOCITY_NOISE = 0.02;          ///< [m/s]
+    static constexpr double DEFAULT_VELOCITY_NOISE_SCALE = 0.002;   ///< [-]
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param stream Noise stream id of this sensor
+     * @param maxAltitude Largest altitude with a ground return [m]
+     * @param velocityNoise Constant part of the noise standard deviation [m/s]
+     * @param velocityNoiseScale Part of the noise standard deviation proportional to speed [-]
+     */
+    Velocimeter(std::uint64_t seed, std::uint64_t stream,
+                double maxAltitude = DEFAULT_MAX_ALTITUDE,
+                double velocityNoise = DEFAULT_VELOCITY_NOISE,
+                double velocityNoiseScale = DEFAULT_VELOCITY_NOISE_SCALE);
+
+    /**
+     * @brief Takes a measurement.
+     *
+     * The noise is specified per sample, so the result does not depend on the
+     * sample interval; @p dt is ignored.
+     *
+     * @param truth True state at the sampling instant
+     */
+    void sample(const SensorTruth& truth, double dt) override;
+
+    /// @return Last velocity in the body frame [m/s]
+    const Vector3& getReading() const;
+
+    /// @return True if the last sample had a ground return
+    bool isValid() const;
+
+    SensorCheckpoint captureCheckpoint() const override;
+
+    void restoreCheckpoint(const SensorCheckpoint& checkpoint) override;
+
+private:
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    NoiseStream noise_;                     ///< Noise source of this sensor
+    double maxAltitude_;                    ///< [m] Largest altitude with a ground return
+    double velocityNoise_;                  ///< [m/s] Constant noise standard deviation
+    double velocityNoiseScale_;             ///< [-] Speed-proportional noise standard deviation
+    Vector3 reading_{0.0, 0.0, 0.0};        ///< [m/s] Last velocity
+    bool valid_ = false;                    ///< Last sample had a ground return
+};
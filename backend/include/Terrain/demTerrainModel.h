@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Terrain/iTerrainModel.h"
+#include "Terrain/mappedFile.h"
+#include "Terrain/terrainTileCache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Describes the layout of a raw DEM file.
+ *
+ * The file is a row-major grid of 32 bit floats in host byte order, optionally
+ * preceded by a header that is skipped. The first row is the northern edge, the
+ * first column the western edge. Samples lie exactly on the bounds, so the
+ * grid spacing is (max - min) / (count - 1). Heights are relative to the
+ * reference sphere (EnvironmentConfig::radiusMoon).
+ */
+struct DemDescriptor
+{
+    std::string path;               ///< Path to the raw float grid
+    int columns = 0;                ///< [-] Samples per row (longitude direction)
+    int rows = 0;                   ///< [-] Number of rows (latitude direction)
+    double minLatitude = 0.0;       ///< [deg] Latitude of the last row
+    double maxLatitude = 0.0;       ///< [deg] Latitude of the first row
+    double minLongitude = 0.0;      ///< [deg] Longitude of the first column
+    double maxLongitude = 0.0;      ///< [deg] Longitude of the last column
+    std::size_t headerBytes = 0;    ///< [bytes] Offset of the first sample, multiple of 4
+};
+
+/**
+ * @class DemTerrainModel
+ * @brief Terrain heights from a memory-mapped digital elevation model.
+ *
+ * The DEM file is memory-mapped, so only the regions the landers fly over are
+ * ever paged in, independent of the total map size.
+ *
+ * Heights are served from tiles of TILE_SIZE² cells organized as a quadtree of
+ * mip levels. Level 0 is the full resolution; level L takes every 2^L-th
+ * sample. The level is chosen from the altitude so that the sample spacing
+ * stays below altitude / lodRatio: high above the surface a coarse level is
+ * sufficient and a few tiles cover the whole ground track, close to the
+ * surface (contact detection) the full resolution is used.
+ *
+ * Tiles are copied out of the mapping into a shared LRU cache, which gives
+ * contiguous memory for interpolation. Lookups go through the cache's
+ * per-thread hint, so the steady state query (same tile as the previous
+ * step) is a lat/lon conversion plus a bilinear interpolation without any
+ * locking.
+ *
+ * Positions outside the DEM coverage return height 0.
+ */
+class DemTerrainModel : public ITerrainModel {
+public:
+    /// Cells per tile side
+    static constexpr int TILE_SIZE = 256;
+
+    /**
+     * @brief Maps the DEM file.
+     * @param descriptor File layout and coverage
+     * @param referenceRadius [m] Radius heights are relative to
+     * @param cacheTiles Maximum number of cached tiles
+     * @param lodRatio [-] Required ratio of altitude to sample spacing
+     * @throws std::runtime_error If the file cannot be mapped or does not match the descriptor
+     */
+    DemTerrainModel(const DemDescriptor& descriptor, double referenceRadius, std::size_t cacheTiles = 64, double lodRatio = 100.0);
+
+    /**
+     * @brief Returns the bilinearly interpolated DEM height below a position.
+     * @param pos Position vector relative to moon center [m]
+     * @return Surface height above the reference sphere [m]
+     */
+    double heightAt(const Vector3& pos) const override;
+
+    /// @return Number of mip levels
+    int levelCount() const;
+
+    /**
+     * @brief Mip level used for queries at a given altitude
+     * @param altitude [m] Height above the reference sphere
+     */
+    int levelForAltitude(double altitude) const;
+
+private:
+    /**
+     * @brief Copies a tile out of the mapped file
+     */
+    TerrainTileCache::TilePtr buildTile(const TerrainTileKey& key) const;
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    DemDescriptor descriptor_;
+    MappedFile file_;
+    const float* samples_ = nullptr;    ///< First sample inside the mapping
+
+    double referenceRadius_;            ///< [m] Reference sphere radius
+    double lodRatio_;                   ///< [-] Altitude / sample spacing
+    double minLatitude_;                ///< [rad]
+    double maxLatitude_;                ///< [rad]
+    double minLongitude_;               ///< [rad]
+    double columnsPerRad_;              ///< [1/rad] Grid columns per radian longitude
+    double rowsPerRad_;                 ///< [1/rad] Grid rows per radian latitude
+    double sampleSpacing_;              ///< [m] Level 0 spacing in latitude direction
+    int levels_ = 1;                    ///< [-] Number of mip levels
+
+    mutable TerrainTileCache cache_;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "vector3.h"
+
+/**
+ * @class ITerrainModel
+ * @brief Interface for lunar surface height models.
+ *
+ * ITerrainModel answers a single question: how high is the surface below a
+ * given point. Heights are measured relative to the reference sphere
+ * (EnvironmentConfig::radiusMoon), so a perfectly spherical moon returns 0
+ * everywhere. The spacecraft uses the height for ground contact and altitude.
+ *
+ * Implementations may be queried every simulation step and by several
+ * landers concurrently. heightAt() must therefore be thread safe and cheap;
+ * anything expensive (file access, tile generation) has to be cached.
+ */
+class ITerrainModel {
+public:
+
+    /**
+     * @brief Virtual destructor to ensure proper cleanup of derived models.
+     */
+    virtual ~ITerrainModel() = default;
+
+    /**
+     * @brief Returns the surface height below a position.
+     *
+     * @param pos Position vector relative to moon center [m]
+     * @return Surface height above the reference sphere [m]
+     */
+    virtual double heightAt(const Vector3& pos) const = 0;
+
+    /**
+     * @brief Hints where heights will be queried soon.
+     *
+     * Called every step with the current state of each lander. Models that
+     * build data lazily may use it to prepare the region along the projected
+     * ground track in the background. Must return quickly and never block on
+     * that work. The default does nothing.
+     *
+     * @param pos Position vector relative to moon center [m]
+     * @param vel Velocity vector [m/s]
+     */
+    virtual void prefetch(const Vector3& /*pos*/, const Vector3& /*vel*/) const {}
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a file.
+ *
+ * The file content is mapped into the address space instead of being read,
+ * so multi-gigabyte files cost no heap memory and only the pages that are
+ * actually touched get loaded by the operating system.
+ *
+ * Uses mmap on POSIX systems and file mappings on Windows.
+ * The class is move-only; the mapping is released in the destructor.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief Maps a file read-only.
+     * @param path Path to the file
+     * @throws std::runtime_error If the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// @return Pointer to the first byte, nullptr if nothing is mapped
+    const unsigned char* data() const { return data_; }
+
+    /// @return Size of the mapping [bytes]
+    std::size_t size() const { return size_; }
+
+    /// @return true if a file is mapped
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief Releases the mapping.
+     */
+    void close();
+
+private:
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
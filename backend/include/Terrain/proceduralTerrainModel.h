@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Terrain/iTerrainModel.h"
+#include "Terrain/terrainTileCache.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Parameters of the procedural lunar surface.
+ *
+ * The same seed and parameters always produce the same surface.
+ */
+struct ProceduralTerrainConfig
+{
+    std::uint64_t seed = 1;             ///< Random seed of the surface
+
+    // Sampling
+    double cellSize = 2.0;              ///< [m] Sample spacing of level 0
+    int maxLevel = 8;                   ///< [-] Coarsest mip level
+    double lodRatio = 100.0;            ///< [-] Required ratio of altitude to sample spacing
+
+    // Rolling terrain (fractal value noise)
+    double noiseAmplitude = 120.0;      ///< [m] Amplitude of the first octave
+    double noiseWavelength = 4000.0;    ///< [m] Wavelength of the first octave
+    int noiseOctaves = 6;               ///< [-] Number of octaves, each half the wavelength and amplitude
+
+    // Craters
+    double largeCraterCell = 1500.0;    ///< [m] Grid cell size for large craters
+    double smallCraterCell = 300.0;     ///< [m] Grid cell size for small craters
+    double craterProbability = 0.3;     ///< [-] Probability of a crater per grid cell
+
+    // Boulders
+    double boulderCell = 30.0;          ///< [m] Grid cell size for boulders
+    double boulderProbability = 0.2;    ///< [-] Probability of a boulder per grid cell
+    double maxBoulderRadius = 3.0;      ///< [m] Largest boulder radius
+
+    // Caching
+    std::size_t cacheTiles = 128;       ///< Maximum number of cached tiles
+    int generatorThreads = 2;           ///< Background threads generating tiles
+    double prefetchHorizon = 30.0;      ///< [s] How far ahead along the ground track tiles are prepared
+};
+
+/**
+ * @class ProceduralTerrainModel
+ * @brief Deterministic synthetic terrain: rolling noise, craters and boulder fields.
+ *
+ * The surface height is a pure function of the point on the reference sphere:
+ * fractal value noise for the large scale relief plus crater and boulder
+ * stamps scattered on jittered 3D grids. Because the function is evaluated in
+ * 3D, the surface is seamless everywhere on the sphere.
+ *
+ * Evaluating the function costs about a microsecond, too much for every query.
+ * Heights are therefore sampled into tiles on a cube map (gnomonic projection,
+ * one grid per face) with mip levels chosen from the altitude, like the DEM
+ * model. Tiles live in a TerrainTileCache and are generated on background
+ * threads when @ref prefetch sees them on the lander's projected ground track.
+ *
+ * A query never waits for generation: if its tile is not ready yet, the four
+ * surrounding grid samples are evaluated directly. Since tiles hold exactly
+ * these samples, both paths return bit-identical heights and the simulation
+ * stays deterministic regardless of thread timing.
+ */
+class ProceduralTerrainModel : public ITerrainModel {
+public:
+    /// Cells per tile side
+    static constexpr int TILE_SIZE = 256;
+
+    /**
+     * @brief Starts the tile generator threads.
+     * @param config Surface parameters
+     * @param referenceRadius [m] Radius heights are relative to
+     */
+    ProceduralTerrainModel(const ProceduralTerrainConfig& config, double referenceRadius);
+
+    /**
+     * @brief Stops the generator threads. Pending requests are dropped.
+     */
+    ~ProceduralTerrainModel() override;
+
+    ProceduralTerrainModel(const ProceduralTerrainModel&) = delete;
+    ProceduralTerrainModel& operator=(const ProceduralTerrainModel&) = delete;
+
+    /**
+     * @brief Returns the interpolated surface height below a position.
+     * @param pos Position vector relative to moon center [m]
+     * @return Surface height above the reference sphere [m]
+     */
+    double heightAt(const Vector3& pos) const override;
+
+    /**
+     * @brief Queues generation of the tiles along the projected ground track.
+     * @param pos Position vector relative to moon center [m]
+     * @param vel Velocity vector [m/s]
+     */
+    void prefetch(const Vector3& pos, const Vector3& vel) const override;
+
+    /**
+     * @brief Evaluates the surface function directly, without tiles.
+     * @param dir Unit vector from the moon center
+     * @return Surface height above the reference sphere [m]
+     */
+    double surfaceHeight(const Vector3& dir) const;
+
+    /// @return Number of tiles waiting for generation
+    std::size_t pendingTiles() const;
+
+private:
+    /**
+     * @brief Grid coordinates of a position on one mip level
+     */
+    struct GridPoint
+    {
+        TerrainTileKey key;     ///< Tile containing the point
+        double u = 0.0;         ///< [-] Column inside the tile, 0..TILE_SIZE
+        double v = 0.0;         ///< [-] Row inside the tile, 0..TILE_SIZE
+    };
+
+    /**
+     * @brief Projects a position onto the cube map grid of a level
+     */
+    GridPoint locate(const Vector3& pos, int level) const;
+
+    /**
+     * @brief Mip level used for queries at a given altitude
+     */
+    int levelForAltitude(double altitude) const;
+
+    /**
+     * @brief Height of a grid sample, rounded to tile precision
+     * @param face Cube face
+     * @param level Mip level
+     * @param gi Global column on the face grid
+     * @param gj Global row on the face grid
+     */
+    float gridSample(std::uint32_t face, int level, std::int64_t gi, std::int64_t gj) const;
+
+    /**
+     * @brief Generates a full tile
+     */
+    TerrainTileCache::TilePtr buildTile(const TerrainTileKey& key) const;
+
+    /**
+     * @brief Adds a tile to the generation queue unless it is cached or queued
+     */
+    void request(const TerrainTileKey& key) const;
+
+    /**
+     * @brief Generator thread main loop
+     */
+    void generatorLoop();
+
+    /**
+     * @brief Height contribution of one crater layer
+     */
+    double craterLayer(const Vector3& p, double cell, std::uint64_t salt) const;
+
+    /**
+     * @brief Height contribution of the boulder field
+     */
+    double boulderLayer(const Vector3& p) const;
+
+    /**
+     * @brief Fractal value noise
+     */
+    double fractalNoise(const Vector3& p) const;
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    ProceduralTerrainConfig config_;
+    double referenceRadius_;            ///< [m] Reference sphere radius
+    double faceStep_;                   ///< [-] Level 0 grid spacing in face coordinates
+
+    mutable TerrainTileCache cache_;
+
+    // Background generation
+    mutable std::mutex queueMutex_;
+    mutable std::condition_variable queueCv_;
+    mutable std::deque<TerrainTileKey> queue_;      ///< Requested tiles, newest at the back
+    mutable std::unordered_set<TerrainTileKey, TerrainTileKeyHash> queued_; ///< Tiles queued or in progress
+    bool stop_ = false;
+    std::vector<std::thread> generators_;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Terrain/iTerrainModel.h"
+
+/**
+ * @class SphericalTerrainModel
+ * @brief Flat terrain: the surface is the reference sphere.
+ *
+ * Default terrain of every spacecraft. Reproduces the classic
+ * "radius equals moon radius" ground contact.
+ */
+class SphericalTerrainModel : public ITerrainModel {
+public:
+
+    /**
+     * @brief Returns 0 for every position.
+     */
+    double heightAt(const Vector3& /*pos*/) const override { return 0.0; }
+};
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Address of a terrain tile: mip level and tile column/row within that level.
+ *
+ * Tiles form a quadtree: the four children of tile (level, x, y) are
+ * (level - 1, 2x + {0,1}, 2y + {0,1}). Level 0 is the full resolution.
+ * Models that tile the whole sphere additionally select a cube face.
+ */
+struct TerrainTileKey
+{
+    std::uint32_t level = 0;    ///< [-] Mip level, 0 = full resolution
+    std::int32_t x = 0;         ///< [-] Tile column
+    std::int32_t y = 0;         ///< [-] Tile row
+    std::uint32_t face = 0;     ///< [-] Cube face for sphere tilings, 0 otherwise
+
+    bool operator==(const TerrainTileKey& other) const
+    {
+        return level == other.level && x == other.x && y == other.y && face == other.face;
+    }
+};
+
+/**
+ * @brief Hash for TerrainTileKey
+ */
+struct TerrainTileKeyHash
+{
+    std::size_t operator()(const TerrainTileKey& key) const
+    {
+        std::uint64_t h = (static_cast<std::uint64_t>(key.face) << 61)
+                        ^ (static_cast<std::uint64_t>(key.level) << 56)
+                        ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.y)) << 29)
+                        ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.x));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+};
+
+/**
+ * @brief Square block of height samples.
+ *
+ * A tile of @c size cells stores (size + 1)² samples, i.e. the samples on its
+ * right and bottom border are duplicated from the neighbouring tiles. Bilinear
+ * interpolation inside a tile therefore never has to touch a second tile.
+ * Tiles are immutable once inserted into the cache.
+ */
+struct TerrainTile
+{
+    TerrainTileKey key;
+    int size = 0;                   ///< [-] Number of cells per side
+    std::vector<float> heights;     ///< [m] Row-major samples, (size + 1) per row
+
+    /// @return [m] Sample at column i, row j
+    float at(int i, int j) const { return heights[static_cast<std::size_t>(j) * (size + 1) + i]; }
+
+    /**
+     * @brief Bilinear interpolation inside the tile
+     * @param u [-] Column coordinate in cells, 0..size
+     * @param v [-] Row coordinate in cells, 0..size
+     * @return [m] Interpolated height
+     */
+    double sample(double u, double v) const
+    {
+        int i = static_cast<int>(u);
+        int j = static_cast<int>(v);
+        if (i >= size) i = size - 1;
+        if (j >= size) j = size - 1;
+
+        const float* row0 = heights.data() + static_cast<std::size_t>(j) * (size + 1) + i;
+        const float* row1 = row0 + (size + 1);
+        return bilinear(row0[0], row0[1], row1[0], row1[1], u - i, v - j);
+    }
+
+    /**
+     * @brief Bilinear interpolation between four samples
+     *
+     * Shared by tiles and by models that evaluate corners directly, so both
+     * paths produce bit-identical results.
+     */
+    static double bilinear(float h00, float h10, float h01, float h11, double fu, double fv)
+    {
+        const double top    = h00 + (h10 - h00) * fu;
+        const double bottom = h01 + (h11 - h01) * fu;
+        return top + (bottom - top) * fv;
+    }
+};
+
+/**
+ * @class TerrainTileCache
+ * @brief Thread safe LRU cache of immutable terrain tiles.
+ *
+ * Tiles are handed out as shared pointers, so a tile evicted while a reader
+ * still uses it stays valid until the reader drops it. All operations take a
+ * single mutex.
+ *
+ * For hot query paths the cache additionally keeps a per-thread hint: the last
+ * tile the calling thread got from @ref findHinted. Repeated queries into the
+ * same tile (the normal case from one step to the next) are served from the
+ * hint without locking.
+ */
+class TerrainTileCache
+{
+public:
+    using TilePtr = std::shared_ptr<const TerrainTile>;
+
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of cached tiles
+     */
+    explicit TerrainTileCache(std::size_t capacity);
+
+    /**
+     * @brief Looks up a tile and marks it as most recently used.
+     * @return Tile or nullptr if it is not cached
+     */
+    TilePtr find(const TerrainTileKey& key);
+
+    /**
+     * @brief Looks up a tile through the calling thread's hint, then the cache.
+     *
+     * The returned pointer stays valid until the calling thread performs its
+     * next hinted lookup on any cache.
+     *
+     * @return Tile or nullptr if it is not cached
+     */
+    const TerrainTile* findHinted(const TerrainTileKey& key);
+
+    /**
+     * @brief Hinted lookup that builds and inserts the tile on a miss.
+     *
+     * The builder runs without holding the cache lock. If two threads build the
+     * same tile concurrently, the first insert wins and both get that tile.
+     *
+     * @param key Tile address
+     * @param build Callable returning a TilePtr
+     * @return Cached tile, valid as described for @ref findHinted
+     */
+    template<typename Build>
+    const TerrainTile* findOrBuildHinted(const TerrainTileKey& key, Build&& build)
+    {
+        if (const TerrainTile* tile = findHinted(key))
+            return tile;
+
+        return setHint(insert(build()));
+    }
+
+    /**
+     * @brief Inserts a tile, evicting the least recently used one when full.
+     * @return The cached tile for this key (an already present tile wins)
+     */
+    TilePtr insert(TilePtr tile);
+
+    /// @return true if the tile is cached. Does not touch the LRU order.
+    bool contains(const TerrainTileKey& key) const;
+
+    /// @brief Drops all tiles
+    void clear();
+
+    /// @return Number of cached tiles
+    std::size_t size() const;
+
+    /// @return Maximum number of cached tiles
+    std::size_t capacity() const;
+
+private:
+    /**
+     * @brief Last tile used by a thread
+     */
+    struct Hint
+    {
+        std::uint64_t owner = 0;    ///< Id of the cache the tile belongs to
+        TilePtr tile;
+    };
+
+    /**
+     * @brief Stores a tile as the calling thread's hint
+     * @return Raw pointer to the tile
+     */
+    const TerrainTile* setHint(TilePtr tile);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    using LruList = std::list<TilePtr>;
+
+    static thread_local Hint hint_;
+
+    std::uint64_t id_;      ///< Unique cache id, never reused
+    mutable std::mutex mutex_;
+    std::size_t capacity_;
+    LruList lru_;   ///< Most recently used at the front
+    std::unordered_map<TerrainTileKey, LruList::iterator, TerrainTileKeyHash> index_;
+};
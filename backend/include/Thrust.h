@@ -8,10 +8,22 @@
 #include "vector3.h"
 #include "Thrust/iThrust.h"
 #include "Thrust/BasicMainEngineModel.h"
+#include "Thrust/BasicRCSThrusterModel.h"
+#include "Thrust/controlAllocator.h"
 #include "Thrust/FuelStateStruct.h"
 #include "Thrust/ME_thrustState.h"
 #include "Thrust/EngineConfig.h"
 #include "Thrust/FueltankStruct.h"
+#include "Checkpoint/simCheckpoint.h"
+
+/**
+ * @brief Propulsion section of a checkpoint, read but not yet applied.
+ */
+struct ThrustCheckpoint
+{
+    std::vector<EngineCheckpoint> engines;  ///< One entry per engine model
+    std::vector<double> tankMasses;         ///< [kg] Propellant mass per tank
+};
 
 /**
  * @brief Enumeration of propulsion system types used for thrust queries.
@@ -76,10 +88,16 @@ enum class EngineType
  * - attitude control / RCS tank
  * - reserve tank
  *
+ * RCS commands are wrenches, not per-thruster values. A @ref ControlAllocator
+ * distributes them over the active "translation" and "rotation" thrusters
+ * using their direction and mounting point. Its matrices are rebuilt only when
+ * an engine is switched on or off.
+ *
  * Current scope:
  * - multi-engine support
  * - 3D thrust vector aggregation
  * - multiple fuel tanks
+ * - RCS control allocation
  *
  * Future scope:
  * - engine groups
@@ -156,8 +174,9 @@ public:
      *
      * @param engines Vector of engine configurations
      * @param tanks Vector of tank masses / capacities [kg]
+     * @param B_centerOfMass Center of mass in the body frame, reference of the RCS torques [m]
      */
-    void initializeEngines(std::vector<EngineConfig> &engines, const std::vector<FuelTank> &tanks);
+    void initializeEngines(std::vector<EngineConfig> &engines, const std::vector<FuelTank> &tanks, const Vector3 &B_centerOfMass = {0.0, 0.0, 0.0});
 
     /**
      * @brief Activates a specific engine.
@@ -196,11 +215,29 @@ public:
      * in vectorized form. The parameter EngineType is necessary for the model
      * routing descision.
      *
+     * Each RCS component in [-1, 1] is a fraction of the translation authority
+     * of the active thrusters along that body axis and direction. The force is
+     * requested with zero torque (see @ref setTargetRCSWrench).
+     *
      * @param tThrustInPercentage Normalized thrust command [0..1]
      * @param engineNr Index of the engine to command
      */
     void setTargetThrustInPercentage(EngineType engine, const double &tMainEngineThrust = 0.0, const Vector3 &tRCSThrust = {0.0, 0.0, 0.0});
 
+    /**
+     * @brief Commands the RCS with a body force and torque.
+     *
+     * The allocator finds the on-levels of the active RCS thrusters that
+     * produce the wrench best in the weighted least-squares sense. The force
+     * error is weighted above the torque error, so a thruster layout without
+     * pure force couples still translates at full authority and any residual
+     * torque is left to attitude control.
+     *
+     * @param B_force Desired force in the body frame [N]
+     * @param B_torque Desired torque about the center of mass in the body frame [N·m]
+     */
+    void setTargetRCSWrench(const Vector3 &B_force, const Vector3 &B_torque);
+
     /**
      * @brief Sets target thrust to zero for all engines.
      *
@@ -269,6 +306,18 @@ public:
      */
     Vector3 getDirectionOfThrust(EngineType engine = EngineType::MainEngine, int engineID = 0) const;
 
+    /**
+     * @brief Returns the torque of the current engine forces.
+     *
+     * Each engine pushes the spacecraft opposite to its thrust direction at
+     * its mounting point. The torque is the sum of r × F with r measured from
+     * the center of mass.
+     *
+     * @param B_centerOfMass Center of mass in the body frame [m]
+     * @return Torque about the center of mass in the body frame [N·m]
+     */
+    Vector3 getCurrentTorque(const Vector3 &B_centerOfMass) const;
+
     /**
      * @brief Returns the total current fuel consumption of all engines.
      *
@@ -311,11 +360,43 @@ public:
      */
     const std::vector<FuelTank>& getFuelTanks() const;
 
+    // -------------------------------------------------------------------------
+    // Checkpoint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Appends the propulsion state to a checkpoint.
+     *
+     * Writes the engine and tank counts, one @ref EngineCheckpoint per engine
+     * model and the current mass of every tank.
+     *
+     * @param writer Checkpoint writer
+     */
+    void writeCheckpoint(CheckpointWriter &writer) const;
+
+    /**
+     * @brief Reads the propulsion section of a checkpoint without applying it.
+     *
+     * @param reader Checkpoint reader positioned at the propulsion section
+     * @param out Receives the decoded section
+     * @throws std::runtime_error If the engine or tank layout does not match
+     */
+    void readCheckpoint(CheckpointReader &reader, ThrustCheckpoint &out) const;
+
+    /**
+     * @brief Applies a section decoded by readCheckpoint().
+     * @param checkpoint Section matching this engine and tank layout
+     */
+    void restoreCheckpoint(const ThrustCheckpoint &checkpoint);
+
 private:
     // -------------------------------------------------------------------------
     // Private Member
     // -------------------------------------------------------------------------
 
+    /// [-] Torque error weight of the RCS allocation relative to the force error [1/m²]
+    static constexpr double RCS_TORQUE_WEIGHT = 0.01;
+
     // -------------------------------------------------------------------------
     // Private Methods
     // -------------------------------------------------------------------------
@@ -357,6 +438,37 @@ private:
      */
     ME_ThrustState ME_thrustState_;
 
+    /**
+     * @brief Center of mass in the body frame, reference point of RCS torques [m]
+     */
+    Vector3 B_centerOfMass_{0.0, 0.0, 0.0};
+
+    /**
+     * @brief Wrench-to-on-level solver of the RCS thrusters.
+     */
+    ControlAllocator rcsAllocator_{1.0, RCS_TORQUE_WEIGHT};
+
+    /**
+     * @brief Index into models_ of each thruster column of rcsAllocator_.
+     */
+    std::vector<size_t> rcsModels_;
+
+    /**
+     * @brief Largest RCS force along +x, +y, +z and along -x, -y, -z [N]
+     */
+    Vector3 rcsAuthorityPositive_{0.0, 0.0, 0.0};
+    Vector3 rcsAuthorityNegative_{0.0, 0.0, 0.0};
+
+    /**
+     * @brief False after an engine power switch changed; the allocator is then rebuilt on the next RCS command.
+     */
+    bool rcsAllocationValid_ = false;
+
+    /**
+     * @brief Rebuilds the RCS allocation from the currently active thrusters.
+     */
+    void refreshRCSAllocation();
+
     /**
      * @brief Adds fuel tanks to the propulsion system.
      *
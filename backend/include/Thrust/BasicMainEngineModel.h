@@ -80,6 +80,12 @@ public:
      */
     int getEngineID() const override;
 
+    /**
+     * @brief Get the state of the engine power switch
+     * @return true if the engine may produce thrust
+     */
+    bool isEngineActivated() const override;
+
     /**
      * @brief Get the Engine Type such as main, translation (RCS), rotation (RCS)
      * @return Engine Type as steady string
@@ -126,6 +132,12 @@ public:
      */
     Vector3 getDirectionOfThrust() const override;
 
+    /**
+     * @brief Getter function for the engine mounting point
+     * @return ///< [m] Engine position in the body frame
+     */
+    Vector3 getEnginePosition() const override;
+
     /**
      * @brief Calculate fuel cunsomption
      * @param fuelMass      ///< [kg] Mass of fuel
@@ -142,6 +154,58 @@ public:
      */
     double getMaxThrust() const override;
 
+    // -------------------------------------------------------------------------
+    // Checkpoint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Captures the dynamic engine state (thrust, fuel bookkeeping, power switch)
+     * @return Engine checkpoint
+     */
+    EngineCheckpoint captureCheckpoint() const override;
+
+    /**
+     * @brief Restores the dynamic engine state captured by captureCheckpoint
+     * @param checkpoint Engine checkpoint
+     */
+    void restoreCheckpoint(const EngineCheckpoint &checkpoint) override;
+
+    // -------------------------------------------------------------------------
+    // Engine dynamics on an arbitrary scalar type
+    // Instantiated for double and SensitivityScalar.
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief First-order thrust response over one timestep (see updateThrust)
+     * @param current       ///< [N] Current thrust
+     * @param target        ///< [N] Target thrust
+     * @param dt            ///< [s] Time step
+     * @param timeConstant  ///< [s] Engine time constant τ, must not be zero
+     * @return              ///< [N] Thrust after dt
+     */
+    template<typename T>
+    static T calcThrustResponse(const T &current, const T &target, const T &dt, const T &timeConstant);
+
+    /**
+     * @brief Calculates mass flow based on thrust
+     * @param currenThrust  ///< [N] Current thrust
+     * @param Isp           ///< [s] Specific impulse
+     * @param earthGravity  ///< [m/s²] Standard gravity g0
+     * @return              ///< [kg/s] Mass flow
+     */
+    template<typename T>
+    static T calcMassFlow(const T &currenThrust, const T &Isp, const T &earthGravity);
+
+    /**
+     * @brief Fuel mass left after burning at a given mass flow
+     * @param fuelMass      ///< [kg] Mass of fuel
+     * @param massFlowFuel  ///< [kg/s] Mass flow of fuel
+     * @param dt            ///< [s] Time step
+     * @return              ///< [kg] Remaining fuel mass
+     */
+    template<typename T>
+    static T calcRemainingFuel(const T &fuelMass, const T &massFlowFuel, const T &dt);
+
 private:
     EngineConfig engineConfig_;      ///< [-] Configuration parameters for a spacecraft engine.
     ME_ThrustState ME_thrustState_;  ///< [-] Dynamic state of the engine thrust.
@@ -155,8 +219,4 @@ private:
      */
     void setDefaultValues();
 
-    // -------------------------------------------------------------------------
-    // Private calculation methods
-    // -------------------------------------------------------------------------
-    double calcMassFlow(const double &currenThrust, const double &Isp, const double &earthGravity);
 };
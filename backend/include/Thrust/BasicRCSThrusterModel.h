@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Thrust/iThrust.h"
+#include "Thrust/FuelStateStruct.h"
+#include "Thrust/EngineConfig.h"
+#include "Thrust/ME_thrustState.h"
+
+/**
+ * @class basicRCSThrusterModel
+ * @brief Single reaction control thruster with a fixed direction and mounting point.
+ *
+ * An RCS thruster only pushes. Its command is an on-level in [0, 1], which is
+ * the duty cycle of the valve averaged over one step, and it is never asked
+ * for more than its maximum thrust. Commands outside this range are clamped.
+ * The valve and chamber response is the same first-order lag as the main
+ * engine, with the thruster's own (much shorter) time constant.
+ *
+ * The on-levels are computed for all RCS thrusters at once by
+ * @ref ControlAllocator inside @ref Thrust.
+ */
+class basicRCSThrusterModel : public IThrustModel{
+
+public:
+    /**
+     * @brief Constructor
+     * @param eConfig Configuration parameters of the thruster
+     * @param fState Fuel-related state variables for the thruster
+     */
+    basicRCSThrusterModel(const EngineConfig& eConfig, FuelState fState);
+
+    ~basicRCSThrusterModel() override = default;
+
+    /**
+     * @brief Moves the current thrust toward the target (first-order response).
+     * @param dt  Time step in seconds.
+     * @throws std::runtime_error if the time constant is zero
+     */
+    void updateThrust(const double &dt) override;
+
+    // -------------------------------------------------------------------------
+    // Public setter override functions
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Opens or closes the thruster supply. A closed thruster ignores commands.
+     * @param activateEngine New switch state
+     */
+    void setEnginePowerSwitch(bool activateEngine) override;
+
+    /**
+     * @brief Set a new target thrust
+     * @param tThrust ///<  [N] Target thrust, clamped to 0 ... maxThrust
+     */
+    void setTarget(const double &tThrust) override;
+
+    /**
+     * @brief Set a new on-level
+     * @param tThrustInPercentage ///<  [-] On-level, clamped to 0.0 ... 1.0
+     */
+    void setTargetInPercentage(const double &tThrustInPercentage) override;
+
+    // -------------------------------------------------------------------------
+    // Public getter override functions
+    // -------------------------------------------------------------------------
+
+    /// @return Engine ID
+    int getEngineID() const override;
+
+    /// @return true if the thruster may produce thrust
+    bool isEngineActivated() const override;
+
+    /// @return Engine type, "translation" or "rotation"
+    std::string getEngineType() const override;
+
+    /// @return ///< [N] target thrust
+    double getTargetThrust() const override;
+
+    /// @return ///< [N] Current thrust
+    double getCurrentThrust() const override;
+
+    /// @return ///< [kg/s] Real-time fuel consumption
+    double getFuelConsumption() const override;
+
+    /// @return ///< [kg] fuel mass
+    double getCurrentFuelMass() const override;
+
+    /// @return ID of the tank feeding the thruster
+    double getTankID() const override;
+
+    /// @return ///< [-] Exhaust direction in the body frame
+    Vector3 getDirectionOfThrust() const override;
+
+    /// @return ///< [m] Thruster position in the body frame
+    Vector3 getEnginePosition() const override;
+
+    /**
+     * @brief Calculate fuel consumption
+     * @param fuelMass      ///< [kg] Mass of fuel
+     * @param massFlowFuel  ///< [kg/s] Mass flow of fuel
+     * @param dt            ///< [s] discrete time step
+     * @return              ///< [kg] Remaining fuel mass
+     */
+    double calcFuelReduction(const double &fuelMass,const double &massFlowFuel,const double &dt) override;
+
+    /// @return ///< [N] Maximum Thrust
+    double getMaxThrust() const override;
+
+    // -------------------------------------------------------------------------
+    // Checkpoint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Captures the dynamic thruster state (thrust, fuel bookkeeping, power switch)
+     * @return Engine checkpoint
+     */
+    EngineCheckpoint captureCheckpoint() const override;
+
+    /**
+     * @brief Restores the dynamic thruster state captured by captureCheckpoint
+     * @param checkpoint Engine checkpoint
+     */
+    void restoreCheckpoint(const EngineCheckpoint &checkpoint) override;
+
+private:
+    EngineConfig engineConfig_;      ///< [-] Configuration parameters of the thruster.
+    ME_ThrustState thrustState_;     ///< [-] Scalar thrust state, same layout as the main engine.
+    FuelState fuelstate_;            ///< [-] Fuel-related state variables for the thruster.
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "vector3.h"
+#include "matrix.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ControlAllocator
+ * @brief Maps a desired body force and torque to thruster on-levels.
+ *
+ * Every thruster i contributes a fixed wrench b_i at full on-level: the
+ * reaction force f_i = -direction_i · maxThrust_i and its torque r_i × f_i about
+ * the center of mass. The allocator solves the bounded least-squares problem
+ * \f[
+ * \min_{0 \le u_i \le 1} \; \lVert W (B u - w) \rVert^2 + \lambda \lVert u \rVert^2
+ * \f]
+ * with B = [b_1 … b_n] (6 × n), the desired wrench w and the diagonal weight W.
+ * The small λ makes the problem strictly convex. Among equivalent thruster
+ * combinations it picks the one with the least propellant.
+ *
+ * With free thrusters F and the others held at a bound, the minimizer is
+ * \f$ u_F = \tilde{B}_F^T (\tilde{B}_F \tilde{B}_F^T + \lambda I)^{-1} r \f$,
+ * where \f$\tilde{B} = WB\f$ and r is the weighted wrench left after the bound
+ * thrusters. Only a 6 × 6 system has to be solved, however many thrusters
+ * there are.
+ *
+ * @ref configure stores \f$\tilde{B}\f$ and the Cholesky factor of the 6 × 6
+ * matrix for all thrusters. It is only called again when the set of active
+ * thrusters changes. @ref allocate works on cached data without allocating:
+ *
+ * 1. Unconstrained minimizer from the cached factor (about 12n flops). If it is
+ *    inside the bounds, it is the solution.
+ * 2. Otherwise a primal active-set method starting from the clamped minimizer.
+ *    Each iteration forms and factors the 6 × 6 matrix of the free thrusters.
+ *    It steps toward their minimizer until a thruster hits a bound, or
+ *    releases the bound thruster with the most negative Lagrange multiplier.
+ *    It ends with the exact optimum.
+ *
+ * For 24 thrusters an iteration is below 1000 flops and a handful of
+ * iterations are typical, so an allocation takes a few microseconds.
+ */
+class ControlAllocator
+{
+public:
+    /// Upper limit of active-set iterations per allocation
+    static constexpr int MAX_ITERATIONS = 64;
+
+    /// [-] Optimality tolerance relative to the largest squared thruster wrench
+    static constexpr double TOLERANCE = 1e-9;
+
+    /// [-] Regularization λ relative to the largest squared thruster wrench
+    static constexpr double REGULARIZATION = 1e-6;
+
+    /**
+     * @brief Constructor
+     * @param forceWeight  Weight of the squared force error [1/N²]
+     * @param torqueWeight Weight of the squared torque error [1/(N·m)²]
+     * @throws std::runtime_error if a weight is not positive
+     */
+    explicit ControlAllocator(double forceWeight = 1.0, double torqueWeight = 1.0);
+
+    /**
+     * @brief Rebuilds the allocation matrix and its factorization.
+     *
+     * Call whenever the thruster set, its geometry or the center of mass
+     * changes. The on-levels of the last allocation are reset to zero.
+     *
+     * @param B_forces  Reaction force of each thruster at full on-level, body frame [N]
+     * @param B_torques Torque of each thruster at full on-level about the center of mass [N·m]
+     * @throws std::runtime_error if the sizes differ
+     */
+    void configure(const std::vector<Vector3>& B_forces, const std::vector<Vector3>& B_torques);
+
+    /**
+     * @brief Solves for the on-levels that best produce a wrench.
+     * @param B_force  Desired force in the body frame [N]
+     * @param B_torque Desired torque about the center of mass [N·m]
+     * @return On-level of each configured thruster in [0, 1]; valid until the next call
+     */
+    const std::vector<double>& allocate(const Vector3& B_force, const Vector3& B_torque);
+
+    /**
+     * @brief Force of the last allocation
+     * @return Achieved force in the body frame [N]
+     */
+    Vector3 achievedForce() const;
+
+    /**
+     * @brief Torque of the last allocation
+     * @return Achieved torque about the center of mass [N·m]
+     */
+    Vector3 achievedTorque() const;
+
+    /// @return Number of configured thrusters
+    std::size_t size() const;
+
+private:
+    /// Number of wrench components (force and torque)
+    static constexpr std::size_t WRENCH = 6;
+
+    /// Wrench in the weighted space
+    using Wrench = Vector6;
+
+    /// Bound state of a thruster in the active-set method
+    enum class Bound : signed char { Lower = -1, Free = 0, Upper = 1 };
+
+    /**
+     * @brief Weighted wrench of the free thrusters' minimizer.
+     *
+     * Forms λI + Σ_F b̃_i b̃_iᵀ, factors it and returns its inverse applied to
+     * @p r. The on-level of free thruster i is then b̃_iᵀ·result.
+     *
+     * @param r Weighted wrench left for the free thrusters
+     * @return (B̃_F B̃_Fᵀ + λI)⁻¹ r
+     */
+    Wrench solveFree(const Wrench& r) const;
+
+    /**
+     * @brief Adds b b̃ᵀ to the lower triangle of a Gram matrix
+     * @param m Gram matrix, updated in place
+     * @param b Weighted thruster column (6 values)
+     */
+    static void addOuterProduct(Matrix6& m, const double* b);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    Wrench weight_;                 ///< Square root of the error weight of each wrench component
+
+    std::size_t n_ = 0;             ///< Number of configured thrusters
+    double lambda_ = 0.0;           ///< Regularization λ
+    double tolerance_ = 0.0;        ///< Absolute optimality tolerance
+    std::vector<double> B_;         ///< Weighted allocation matrix B̃, column-major 6 × n
+    Matrix6 factor_{};              ///< Cholesky factor of B̃B̃ᵀ + λI over all thrusters
+    std::vector<double> u_;         ///< On-levels of the last allocation
+    std::vector<double> step_;      ///< Work vector, minimizer of the free thrusters
+    std::vector<Bound> bound_;      ///< Work vector, bound state per thruster
+};
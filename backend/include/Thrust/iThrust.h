@@ -1,8 +1,20 @@
 #pragma once
 
 #include "vector3.h"
+#include "Thrust/ME_thrustState.h"
+#include "Thrust/FuelStateStruct.h"
 #include <iostream>
 
+/**
+ * @brief Dynamic state of a single engine model as stored in a simulation checkpoint.
+ */
+struct EngineCheckpoint
+{
+    ME_ThrustState thrustState;     ///< Commanded and actual thrust
+    FuelState fuelState;            ///< Engine-side fuel bookkeeping
+    bool engineActivated = false;   ///< Engine power switch
+};
+
 class IThrustModel{
 public:
 
@@ -14,6 +26,8 @@ public:
 
     virtual void        setEnginePowerSwitch(bool activateEngine) = 0;
 
+    virtual bool        isEngineActivated() const = 0;
+
     virtual void        setTarget(const double &tThrust) = 0;
 
     virtual void        setTargetInPercentage(const double &tThrustInPercentage) = 0;
@@ -28,6 +42,8 @@ public:
 
     virtual Vector3     getDirectionOfThrust() const = 0;
 
+    virtual Vector3     getEnginePosition() const = 0;
+
     virtual double      getFuelConsumption() const = 0;
 
     virtual double      getCurrentFuelMass() const = 0;
@@ -35,4 +51,8 @@ public:
     virtual double      getTankID() const = 0;
 
     virtual double      getMaxThrust() const = 0;
+
+    virtual EngineCheckpoint captureCheckpoint() const = 0;
+
+    virtual void        restoreCheckpoint(const EngineCheckpoint &checkpoint) = 0;
 };
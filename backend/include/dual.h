@@ -0,0 +1,171 @@
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+
+/**
+ * @brief Dual number for forward-mode automatic differentiation.
+ *
+ * Carries a value and its partial derivatives with respect to @p N seed
+ * parameters. Arithmetic applies the chain rule, so any code templated on the
+ * scalar type (see @ref Vector3T, @ref IPhysicsModelT, @ref IIntegratorT)
+ * returns exact derivatives in a single evaluation instead of 2N finite
+ * difference runs.
+ *
+ * Comparisons only look at the value. Branches, clamps and saturations
+ * therefore pick the same path as the double computation and the derivatives
+ * follow that path.
+ *
+ * Math functions are hidden friends. Generic code calls them unqualified after
+ * `using std::sqrt;` so that argument-dependent lookup finds them.
+ *
+ * @tparam N Number of parameters the derivatives are taken with respect to
+ */
+template<std::size_t N>
+struct Dual
+{
+    double value = 0.0;                 ///< Function value
+    std::array<double, N> grad{};       ///< Partial derivatives ∂value/∂p_i
+
+    // -------------------------------------------------------------------------
+    // Construction
+    // -------------------------------------------------------------------------
+
+    constexpr Dual() = default;
+
+    /**
+     * @brief Constant with zero derivatives. Implicit so that literals and
+     *        double parameters mix freely with dual numbers.
+     * @param v Value
+     */
+    constexpr Dual(double v) : value(v) {}
+
+    /**
+     * @brief Seeds parameter @p index: value @p v with ∂/∂p_index = 1
+     * @param v Parameter value
+     * @param index Parameter index in [0, N)
+     * @return Seeded dual number
+     */
+    static constexpr Dual variable(double v, std::size_t index)
+    {
+        Dual d(v);
+        d.grad[index] = 1.0;
+        return d;
+    }
+
+    // -------------------------------------------------------------------------
+    // Arithmetic
+    // -------------------------------------------------------------------------
+
+    constexpr Dual& operator+=(const Dual& o)
+    {
+        value += o.value;
+        for (std::size_t i = 0; i < N; ++i) grad[i] += o.grad[i];
+        return *this;
+    }
+
+    constexpr Dual& operator-=(const Dual& o)
+    {
+        value -= o.value;
+        for (std::size_t i = 0; i < N; ++i) grad[i] -= o.grad[i];
+        return *this;
+    }
+
+    constexpr Dual& operator*=(const Dual& o)
+    {
+        // (uv)' = u'v + uv'
+        for (std::size_t i = 0; i < N; ++i) grad[i] = grad[i] * o.value + value * o.grad[i];
+        value *= o.value;
+        return *this;
+    }
+
+    constexpr Dual& operator/=(const Dual& o)
+    {
+        // (u/v)' = (u' - (u/v) v') / v
+        const double q = value / o.value;
+        for (std::size_t i = 0; i < N; ++i) grad[i] = (grad[i] - q * o.grad[i]) / o.value;
+        value = q;
+        return *this;
+    }
+
+    constexpr Dual operator-() const
+    {
+        Dual r;
+        r.value = -value;
+        for (std::size_t i = 0; i < N; ++i) r.grad[i] = -grad[i];
+        return r;
+    }
+
+    friend constexpr Dual operator+(Dual a, const Dual& b) { return a += b; }
+    friend constexpr Dual operator-(Dual a, const Dual& b) { return a -= b; }
+    friend constexpr Dual operator*(Dual a, const Dual& b) { return a *= b; }
+    friend constexpr Dual operator/(Dual a, const Dual& b) { return a /= b; }
+
+    // -------------------------------------------------------------------------
+    // Comparison (value only)
+    // -------------------------------------------------------------------------
+
+    friend constexpr bool operator==(const Dual& a, const Dual& b) { return a.value == b.value; }
+    friend constexpr auto operator<=>(const Dual& a, const Dual& b) { return a.value <=> b.value; }
+
+    // -------------------------------------------------------------------------
+    // Math functions
+    // -------------------------------------------------------------------------
+
+    friend Dual sqrt(const Dual& a)
+    {
+        // (√u)' = u' / (2√u)
+        return a.chain(std::sqrt(a.value), 0.5 / std::sqrt(a.value));
+    }
+
+    friend Dual exp(const Dual& a)
+    {
+        const double e = std::exp(a.value);
+        return a.chain(e, e);
+    }
+
+    friend Dual abs(const Dual& a)
+    {
+        return a.value < 0.0 ? -a : a;
+    }
+
+private:
+    /**
+     * @brief Result of f(this) given f and f' evaluated at the value
+     * @param f Function value
+     * @param df Derivative of f at the value
+     * @return Dual number with grad = df * this->grad
+     */
+    constexpr Dual chain(double f, double df) const
+    {
+        Dual r(f);
+        for (std::size_t i = 0; i < N; ++i) r.grad[i] = df * grad[i];
+        return r;
+    }
+};
+
+/**
+ * @brief Plain value of a scalar, dropping derivatives
+ * @param x Scalar
+ * @return @p x
+ */
+inline constexpr double valueOf(double x) { return x; }
+
+/**
+ * @brief Plain value of a dual number, dropping derivatives
+ * @param x Dual number
+ * @return Value part of @p x
+ */
+template<std::size_t N>
+constexpr double valueOf(const Dual<N>& x) { return x.value; }
+
+/// Number of parameters traced by a sensitivity run (see DescentSensitivity)
+inline constexpr std::size_t SENSITIVITY_PARAMETERS = 5;
+
+/// Scalar type of a sensitivity run. Templates are instantiated for it next to double.
+using SensitivityScalar = Dual<SENSITIVITY_PARAMETERS>;
+
+#endif // DUAL_H
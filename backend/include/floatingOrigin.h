@@ -0,0 +1,85 @@
+#ifndef FLOATINGORIGIN_H
+#define FLOATINGORIGIN_H
+
+#include "vector3.h"
+
+/**
+ * @class FloatingOrigin
+ * @brief Local reference point that follows the spacecraft.
+ *
+ * Moon-centered positions are around 1.7e6 m, where one double ulp is about
+ * 2e-10 m and a float ulp is 0.125 m. Integrating small per-step displacements
+ * onto such values throws away precision. The spacecraft therefore integrates
+ * its position relative to a local origin close to itself and only converts to
+ * absolute coordinates on output.
+ *
+ * The origin always lies on a grid of @ref GRID meters. Grid points and the
+ * shifts between them are exact in double, so rebasing changes the local
+ * coordinates without rounding. Local coordinates stay within about one grid
+ * step per axis, small enough for float32 computations.
+ */
+class FloatingOrigin
+{
+public:
+    /// [m] Grid spacing of the origin. A power of two keeps all shifts exact.
+    static constexpr double GRID = 1024.0;
+
+    /**
+     * @brief Places the origin on the grid point nearest to an absolute position
+     * @param absolute Absolute position [m]
+     * @return Local coordinates of @p absolute [m]
+     */
+    Vector3 reset(const Vector3& absolute);
+
+    /**
+     * @brief Moves the origin when a local position left the current grid cell
+     *
+     * Once a local coordinate exceeds one grid step, the origin moves to the
+     * grid point nearest to the position and @p local is adjusted by the same
+     * amount. The absolute position is unchanged. The hysteresis between half
+     * and one grid step avoids rebasing every step near a cell border.
+     *
+     * @param local Local position [m], updated in place
+     * @return true if the origin moved
+     */
+    bool rebase(Vector3& local);
+
+    /**
+     * @brief Converts local coordinates to absolute coordinates
+     * @param local Local position [m]
+     * @return Absolute position [m]
+     */
+    Vector3 toAbsolute(const Vector3& local) const;
+
+    /**
+     * @brief Converts absolute coordinates to local coordinates
+     * @param absolute Absolute position [m]
+     * @return Local position [m]
+     */
+    Vector3 toLocal(const Vector3& absolute) const;
+
+    /// @return Current origin in absolute coordinates [m]
+    const Vector3& origin() const;
+
+    /**
+     * @brief Sets the origin directly, e.g. when restoring a checkpoint
+     * @param origin Grid point [m]
+     */
+    void setOrigin(const Vector3& origin);
+
+private:
+    /**
+     * @brief Nearest grid coordinate
+     * @param value Coordinate [m]
+     * @return Multiple of @ref GRID [m]
+     */
+    static double snap(double value);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    Vector3 origin_ = {0.0, 0.0, 0.0};     ///< [m] Absolute position of the local origin
+};
+
+#endif // FLOATINGORIGIN_H
@@ -0,0 +1,136 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "customSpacecraftStruct.h"
+
+/**
+ * @brief Location of one spacecraft entry inside a catalog document.
+ */
+struct CatalogEntry {
+    std::size_t offset = 0;     ///< Byte offset of the opening '{' of the entry
+    std::size_t length = 0;     ///< Byte length up to and including the closing '}'
+    std::string name;           ///< Value of the entry's "name" field (empty if absent)
+};
+
+/**
+ * @class jsonCatalogReader
+ * @brief Streaming reader for large spacecraft catalog files.
+ *
+ * Unlike @ref jsonConfigReader::loadConfig, which builds a full DOM, the catalog
+ * reader walks the top-level "spacecraft" array once with a SAX handler and only
+ * records where each entry starts and ends. No entry is parsed into a DOM during
+ * indexing, so memory is bounded by the index itself (one @ref CatalogEntry per
+ * spacecraft) rather than by the catalog size.
+ *
+ * Selecting an entry is O(1): the reader seeks to the recorded offset, parses
+ * only that entry's bytes and hands the result to @ref jsonConfigReader::parseLander.
+ *
+ * The catalog can be backed either by a file on disk or by a caller-owned memory
+ * block (e.g. a memory-mapped file or a Qt resource). In the latter case the
+ * memory must outlive the reader.
+ *
+ * Expected layout:
+ * @code
+ * {
+ *   "spacecraft": [
+ *     { "name": "...", ... },
+ *     ...
+ *   ]
+ * }
+ * @endcode
+ */
+class jsonCatalogReader {
+public:
+
+    jsonCatalogReader() = default;
+    ~jsonCatalogReader() = default;
+
+    /**
+     * @brief Indexes a catalog file on disk.
+     *
+     * The file is streamed through the SAX parser; only the index is kept in memory.
+     *
+     * @param filename Path to the catalog JSON file.
+     * @throws std::runtime_error If the file cannot be opened or is not valid JSON.
+     */
+    void openFile(const std::string& filename);
+
+    /**
+     * @brief Indexes a catalog held in memory.
+     *
+     * The reader does not copy the data; @p data must stay valid until the
+     * reader is closed, reopened or destroyed.
+     *
+     * @param data Pointer to the JSON text.
+     * @param size Size of the JSON text in bytes.
+     * @throws std::runtime_error If the buffer is not valid JSON.
+     */
+    void openBuffer(const char* data, std::size_t size);
+
+    /**
+     * @brief Drops the index and releases the catalog source.
+     */
+    void close();
+
+    /**
+     * @brief Returns the number of indexed spacecraft entries.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the index record of an entry.
+     *
+     * @param index Entry index.
+     * @throws std::out_of_range If @p index is out of range.
+     */
+    const CatalogEntry& entry(std::size_t index) const;
+
+    /**
+     * @brief Returns the raw JSON text of a single entry.
+     *
+     * @param index Entry index.
+     * @return JSON object text exactly as stored in the catalog.
+     * @throws std::out_of_range If @p index is out of range.
+     * @throws std::runtime_error If the backing file can no longer be read.
+     */
+    std::string rawEntry(std::size_t index) const;
+
+    /**
+     * @brief Parses a single entry into a JSON object.
+     *
+     * @param index Entry index.
+     * @return Parsed JSON object of the entry.
+     */
+    nlohmann::json entryJson(std::size_t index) const;
+
+    /**
+     * @brief Materializes a single entry as a spacecraft configuration.
+     *
+     * @param index Entry index.
+     * @return Fully initialized customSpacecraft instance.
+     * @throws nlohmann::json::exception If required fields are missing or have wrong type.
+     */
+    customSpacecraft materialize(std::size_t index) const;
+
+private:
+
+    /**
+     * @brief Runs the SAX indexing pass over the given byte range.
+     *
+     * @tparam Iterator Input iterator over the catalog bytes.
+     */
+    template<typename Iterator>
+    void buildIndex(Iterator first, Iterator last);
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    std::string filename_;              ///< Backing file (empty if memory-backed)
+    const char* data_ = nullptr;        ///< Backing memory block (nullptr if file-backed)
+    std::size_t dataSize_ = 0;          ///< Size of the backing memory block [bytes]
+    std::vector<CatalogEntry> entries_; ///< Byte-offset index of the spacecraft array
+};
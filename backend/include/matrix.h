@@ -0,0 +1,554 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include "vector3.h"
+#include "quaternion.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Fixed-size dense matrix.
+ *
+ * Storage is a row-major std::array member, so a matrix lives wherever its
+ * owner lives. There is no heap allocation, and a 9 × 9 covariance (648
+ * bytes) stays in L1 next to the state it belongs to. Every loop bound is a
+ * compile-time constant, so the compiler unrolls the small loops completely.
+ * The row update of the product is a '#pragma omp simd' loop, like the other
+ * hot loops of the backend.
+ *
+ * The class covers what estimation and rigid-body code needs: products,
+ * transpose, inverse and Cholesky factorization for square matrices. It also
+ * converts to and from @ref Vector3T and builds rotation matrices from
+ * @ref QuaternionT. Column vectors are Matrix<N, 1> (see @ref VectorN).
+ *
+ * Only operations that need a square root are not constexpr. Like
+ * @ref Vector3T, generic code calls sqrt unqualified, so custom scalar types
+ * such as @ref Dual work as well.
+ *
+ * @tparam N Number of rows
+ * @tparam M Number of columns
+ * @tparam T Scalar type (float or double)
+ */
+template<std::size_t N, std::size_t M, typename T = double>
+struct Matrix
+{
+    static_assert(N > 0 && M > 0, "Matrix: dimensions must be positive");
+
+    std::array<T, N * M> data{};    ///< Elements, row-major
+
+    // -------------------------------------------------------------------------
+    // Construction
+    // -------------------------------------------------------------------------
+
+    /// @return Matrix with all elements zero
+    static constexpr Matrix zero()
+    {
+        return Matrix{};
+    }
+
+    /// @return Identity matrix (square only)
+    static constexpr Matrix identity()
+    {
+        static_assert(N == M, "Matrix: identity requires a square matrix");
+        Matrix r{};
+        for (std::size_t i = 0; i < N; ++i) r(i, i) = T(1);
+        return r;
+    }
+
+    /**
+     * @brief Diagonal matrix, e.g. a principal inertia tensor.
+     * @param d Diagonal elements
+     * @return diag(d.x, d.y, d.z)
+     */
+    static constexpr Matrix diagonal(const Vector3T<T>& d)
+    {
+        static_assert(N == 3 && M == 3, "Matrix: diagonal(Vector3) requires a 3x3 matrix");
+        Matrix r{};
+        r(0, 0) = d.x;
+        r(1, 1) = d.y;
+        r(2, 2) = d.z;
+        return r;
+    }
+
+    /**
+     * @brief Column vector from a Vector3.
+     * @param v Vector
+     * @return 3 × 1 matrix (v.x, v.y, v.z)ᵀ
+     */
+    static constexpr Matrix column(const Vector3T<T>& v)
+    {
+        static_assert(N == 3 && M == 1, "Matrix: column(Vector3) requires a 3x1 matrix");
+        Matrix r{};
+        r.data = {v.x, v.y, v.z};
+        return r;
+    }
+
+    /**
+     * @brief Cross-product matrix, [v]ₓ w = v × w.
+     * @param v Vector
+     * @return Skew-symmetric 3 × 3 matrix of @p v
+     */
+    static constexpr Matrix skew(const Vector3T<T>& v)
+    {
+        static_assert(N == 3 && M == 3, "Matrix: skew requires a 3x3 matrix");
+        Matrix r{};
+        r.data = { T(0), -v.z,  v.y,
+                   v.z,  T(0), -v.x,
+                  -v.y,  v.x,  T(0)};
+        return r;
+    }
+
+    /**
+     * @brief Rotation matrix of a unit quaternion.
+     *
+     * Maps body vectors to the inertial frame like QuaternionT::rotate:
+     * R v = q ⊗ (0, v) ⊗ q*.
+     *
+     * @param q Body-to-inertial orientation
+     * @return Direction cosine matrix
+     */
+    static constexpr Matrix rotation(const QuaternionT<T>& q)
+    {
+        static_assert(N == 3 && M == 3, "Matrix: rotation requires a 3x3 matrix");
+        const T w = q.getQ0(), x = q.getQ1(), y = q.getQ2(), z = q.getQ3();
+        Matrix r{};
+        r.data = {T(1) - T(2) * (y * y + z * z), T(2) * (x * y - w * z),        T(2) * (x * z + w * y),
+                  T(2) * (x * y + w * z),        T(1) - T(2) * (x * x + z * z), T(2) * (y * z - w * x),
+                  T(2) * (x * z - w * y),        T(2) * (y * z + w * x),        T(1) - T(2) * (x * x + y * y)};
+        return r;
+    }
+
+    // -------------------------------------------------------------------------
+    // Element access
+    // -------------------------------------------------------------------------
+
+    /// @return Number of rows
+    static constexpr std::size_t rows() { return N; }
+
+    /// @return Number of columns
+    static constexpr std::size_t cols() { return M; }
+
+    /**
+     * @param i Row index
+     * @param j Column index
+     * @return Element (i, j)
+     */
+    constexpr T& operator()(std::size_t i, std::size_t j) { return data[i * M + j]; }
+    constexpr const T& operator()(std::size_t i, std::size_t j) const { return data[i * M + j]; }
+
+    /**
+     * @brief Element of a column vector.
+     * @param i Row index
+     * @return Element (i, 0)
+     */
+    constexpr T& operator[](std::size_t i)
+    {
+        static_assert(M == 1, "Matrix: operator[] requires a column vector");
+        return data[i];
+    }
+    constexpr const T& operator[](std::size_t i) const
+    {
+        static_assert(M == 1, "Matrix: operator[] requires a column vector");
+        return data[i];
+    }
+
+    /**
+     * @brief Three consecutive elements of a column vector as Vector3.
+     * @param offset Index of the first element
+     * @return (v[offset], v[offset + 1], v[offset + 2])
+     */
+    constexpr Vector3T<T> segment3(std::size_t offset = 0) const
+    {
+        static_assert(M == 1 && N >= 3, "Matrix: segment3 requires a column vector with at least 3 rows");
+        return {data[offset], data[offset + 1], data[offset + 2]};
+    }
+
+    /**
+     * @brief Writes a Vector3 into three consecutive elements of a column vector.
+     * @param offset Index of the first element
+     * @param v Vector to write
+     */
+    constexpr void setSegment3(std::size_t offset, const Vector3T<T>& v)
+    {
+        static_assert(M == 1 && N >= 3, "Matrix: setSegment3 requires a column vector with at least 3 rows");
+        data[offset]     = v.x;
+        data[offset + 1] = v.y;
+        data[offset + 2] = v.z;
+    }
+
+    // -------------------------------------------------------------------------
+    // Arithmetic
+    // -------------------------------------------------------------------------
+
+    constexpr Matrix& operator+=(const Matrix& o)
+    {
+        for (std::size_t i = 0; i < N * M; ++i) data[i] += o.data[i];
+        return *this;
+    }
+
+    constexpr Matrix& operator-=(const Matrix& o)
+    {
+        for (std::size_t i = 0; i < N * M; ++i) data[i] -= o.data[i];
+        return *this;
+    }
+
+    constexpr Matrix& operator*=(T s)
+    {
+        for (std::size_t i = 0; i < N * M; ++i) data[i] *= s;
+        return *this;
+    }
+
+    constexpr Matrix operator+(const Matrix& o) const { Matrix r = *this; return r += o; }
+    constexpr Matrix operator-(const Matrix& o) const { Matrix r = *this; return r -= o; }
+    constexpr Matrix operator*(T s) const { Matrix r = *this; return r *= s; }
+    constexpr Matrix operator/(T s) const { Matrix r = *this; return r *= T(1) / s; }
+
+    constexpr Matrix operator-() const
+    {
+        Matrix r;
+        for (std::size_t i = 0; i < N * M; ++i) r.data[i] = -data[i];
+        return r;
+    }
+
+    /**
+     * @brief Matrix product.
+     * @param o Right-hand factor (M × K)
+     * @return this · o (N × K)
+     */
+    template<std::size_t K>
+    constexpr Matrix<N, K, T> operator*(const Matrix<M, K, T>& o) const
+    {
+        Matrix<N, K, T> r{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t k = 0; k < M; ++k)
+            {
+                const T a = (*this)(i, k);
+                T* row = &r.data[i * K];
+                const T* other = &o.data[k * K];
+
+                // GCC cannot constant-evaluate an omp simd loop
+                if (std::is_constant_evaluated())
+                {
+                    for (std::size_t j = 0; j < K; ++j) row[j] += a * other[j];
+                }
+                else
+                {
+                    #pragma omp simd
+                    for (std::size_t j = 0; j < K; ++j) row[j] += a * other[j];
+                }
+            }
+        }
+        return r;
+    }
+
+    /**
+     * @brief Product with a Vector3, e.g. a rotation or inertia tensor.
+     * @param v Vector
+     * @return this · v
+     */
+    constexpr Vector3T<T> operator*(const Vector3T<T>& v) const
+    {
+        static_assert(N == 3 && M == 3, "Matrix: product with Vector3 requires a 3x3 matrix");
+        return {data[0] * v.x + data[1] * v.y + data[2] * v.z,
+                data[3] * v.x + data[4] * v.y + data[5] * v.z,
+                data[6] * v.x + data[7] * v.y + data[8] * v.z};
+    }
+
+    constexpr bool operator==(const Matrix& o) const { return data == o.data; }
+
+    // -------------------------------------------------------------------------
+    // Matrix operations
+    // -------------------------------------------------------------------------
+
+    /// @return Transposed matrix (M × N)
+    constexpr Matrix<M, N, T> transpose() const
+    {
+        Matrix<M, N, T> r;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < M; ++j)
+            {
+                r(j, i) = (*this)(i, j);
+            }
+        }
+        return r;
+    }
+
+    /// @return Sum of the diagonal elements (square only)
+    constexpr T trace() const
+    {
+        static_assert(N == M, "Matrix: trace requires a square matrix");
+        T sum{0};
+        for (std::size_t i = 0; i < N; ++i) sum += (*this)(i, i);
+        return sum;
+    }
+
+    /**
+     * @brief Mean of the matrix and its transpose.
+     *
+     * Covariance updates lose symmetry by rounding; calling this after each
+     * update keeps them symmetric.
+     *
+     * @return (A + Aᵀ) / 2
+     */
+    constexpr Matrix symmetrized() const
+    {
+        static_assert(N == M, "Matrix: symmetrized requires a square matrix");
+        Matrix r = *this;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                const T mean = T(0.5) * ((*this)(i, j) + (*this)(j, i));
+                r(i, j) = mean;
+                r(j, i) = mean;
+            }
+        }
+        return r;
+    }
+
+    /**
+     * @brief Dot product of two column vectors.
+     * @param o Second vector
+     * @return Σ this[i] · o[i]
+     */
+    constexpr T dot(const Matrix& o) const
+    {
+        static_assert(M == 1, "Matrix: dot requires column vectors");
+        T sum{0};
+        for (std::size_t i = 0; i < N; ++i) sum += data[i] * o.data[i];
+        return sum;
+    }
+
+    /// @return Frobenius norm, the Euclidean norm for column vectors
+    T norm() const
+    {
+        using std::sqrt;
+        T sum{0};
+        for (std::size_t i = 0; i < N * M; ++i) sum += data[i] * data[i];
+        return sqrt(sum);
+    }
+
+    /**
+     * @brief Determinant (square matrices up to 3 × 3).
+     * @return det(this)
+     */
+    constexpr T determinant() const
+    {
+        static_assert(N == M && N <= 3, "Matrix: determinant is implemented up to 3x3");
+        if constexpr (N == 1)
+        {
+            return data[0];
+        }
+        else if constexpr (N == 2)
+        {
+            return data[0] * data[3] - data[1] * data[2];
+        }
+        else
+        {
+            return data[0] * (data[4] * data[8] - data[5] * data[7])
+                 - data[1] * (data[3] * data[8] - data[5] * data[6])
+                 + data[2] * (data[3] * data[7] - data[4] * data[6]);
+        }
+    }
+
+    /**
+     * @brief Inverse of a square matrix.
+     *
+     * Up to 3 × 3 the adjugate formula is used. Larger matrices use Gauss-Jordan
+     * elimination with partial pivoting. For symmetric positive definite
+     * matrices prefer @ref cholesky with @ref choleskySolve.
+     *
+     * @return this⁻¹
+     * @throws std::runtime_error if the matrix is singular
+     */
+    constexpr Matrix inverse() const
+    {
+        static_assert(N == M, "Matrix: inverse requires a square matrix");
+
+        if constexpr (N <= 3)
+        {
+            const T det = determinant();
+            if (det == T(0))
+            {
+                throw std::runtime_error("Matrix: matrix is singular");
+            }
+            const T s = T(1) / det;
+
+            Matrix r;
+            if constexpr (N == 1)
+            {
+                r.data = {s};
+            }
+            else if constexpr (N == 2)
+            {
+                r.data = { data[3] * s, -data[1] * s,
+                          -data[2] * s,  data[0] * s};
+            }
+            else
+            {
+                r.data = {(data[4] * data[8] - data[5] * data[7]) * s,
+                          (data[2] * data[7] - data[1] * data[8]) * s,
+                          (data[1] * data[5] - data[2] * data[4]) * s,
+                          (data[5] * data[6] - data[3] * data[8]) * s,
+                          (data[0] * data[8] - data[2] * data[6]) * s,
+                          (data[2] * data[3] - data[0] * data[5]) * s,
+                          (data[3] * data[7] - data[4] * data[6]) * s,
+                          (data[1] * data[6] - data[0] * data[7]) * s,
+                          (data[0] * data[4] - data[1] * data[3]) * s};
+            }
+            return r;
+        }
+        else
+        {
+            Matrix a = *this;
+            Matrix r = identity();
+
+            for (std::size_t c = 0; c < N; ++c)
+            {
+                // Partial pivoting
+                std::size_t pivot = c;
+                for (std::size_t i = c + 1; i < N; ++i)
+                {
+                    if (abs(a(i, c)) > abs(a(pivot, c))) pivot = i;
+                }
+                if (a(pivot, c) == T(0))
+                {
+                    throw std::runtime_error("Matrix: matrix is singular");
+                }
+                if (pivot != c)
+                {
+                    for (std::size_t j = 0; j < N; ++j)
+                    {
+                        std::swap(a(c, j), a(pivot, j));
+                        std::swap(r(c, j), r(pivot, j));
+                    }
+                }
+
+                const T s = T(1) / a(c, c);
+                for (std::size_t j = 0; j < N; ++j)
+                {
+                    a(c, j) *= s;
+                    r(c, j) *= s;
+                }
+
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if (i == c) continue;
+                    const T f = a(i, c);
+                    for (std::size_t j = 0; j < N; ++j)
+                    {
+                        a(i, j) -= f * a(c, j);
+                        r(i, j) -= f * r(c, j);
+                    }
+                }
+            }
+            return r;
+        }
+    }
+
+    /**
+     * @brief Cholesky factor of a symmetric positive definite matrix.
+     *
+     * Only the lower triangle is read, so callers may fill just that half.
+     *
+     * @return Lower triangular L with L Lᵀ = this
+     * @throws std::runtime_error if the matrix is not positive definite
+     */
+    Matrix cholesky() const
+    {
+        static_assert(N == M, "Matrix: cholesky requires a square matrix");
+        using std::sqrt;
+
+        Matrix L{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j <= i; ++j)
+            {
+                T sum = (*this)(i, j);
+                for (std::size_t k = 0; k < j; ++k)
+                {
+                    sum -= L(i, k) * L(j, k);
+                }
+
+                if (i == j)
+                {
+                    if (!(sum > T(0)))
+                    {
+                        throw std::runtime_error("Matrix: matrix is not positive definite");
+                    }
+                    L(i, i) = sqrt(sum);
+                }
+                else
+                {
+                    L(i, j) = sum / L(j, j);
+                }
+            }
+        }
+        return L;
+    }
+
+    /**
+     * @brief Solves (L Lᵀ) X = B with this as the Cholesky factor L.
+     * @param b Right-hand side (N × K)
+     * @return Solution X (N × K)
+     */
+    template<std::size_t K>
+    constexpr Matrix<N, K, T> choleskySolve(Matrix<N, K, T> b) const
+    {
+        static_assert(N == M, "Matrix: choleskySolve requires a square factor");
+        const Matrix& L = *this;
+
+        for (std::size_t c = 0; c < K; ++c)
+        {
+            // Forward substitution L y = b
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                T sum = b(i, c);
+                for (std::size_t k = 0; k < i; ++k) sum -= L(i, k) * b(k, c);
+                b(i, c) = sum / L(i, i);
+            }
+
+            // Back substitution Lᵀ x = y
+            for (std::size_t i = N; i-- > 0;)
+            {
+                T sum = b(i, c);
+                for (std::size_t k = i + 1; k < N; ++k) sum -= L(k, i) * b(k, c);
+                b(i, c) = sum / L(i, i);
+            }
+        }
+        return b;
+    }
+
+private:
+    /// Magnitude for pivoting, written with comparisons so that custom scalar types need no abs overload
+    static constexpr T abs(const T& x) { return x < T(0) ? -x : x; }
+};
+
+/**
+ * @brief Scalar times matrix.
+ * @param s Scalar
+ * @param m Matrix
+ * @return s · m
+ */
+template<std::size_t N, std::size_t M, typename T>
+constexpr Matrix<N, M, T> operator*(T s, const Matrix<N, M, T>& m)
+{
+    return m * s;
+}
+
+/// Column vector with N elements
+template<std::size_t N, typename T = double>
+using VectorN = Matrix<N, 1, T>;
+
+using Matrix3 = Matrix<3, 3>;   ///< Rotation matrices, inertia tensors
+using Matrix6 = Matrix<6, 6>;   ///< Wrench and rigid-body state blocks
+using Matrix9 = Matrix<9, 9>;   ///< Error-state covariance blocks
+using Vector6 = VectorN<6>;     ///< Wrench (force, torque) and similar 6-vectors
+
+#endif // MATRIX_H
@@ -0,0 +1,275 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Maps a 128-bit counter and a 64-bit key to 128 random bits with ten rounds
+ * of multiply-xor mixing (Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", SC'11). The output is a pure function of (counter, key). There is
+ * no sequential state. Any block of any stream can therefore be generated
+ * directly, in any order and on any thread, and the result is the same.
+ *
+ * The generator passes BigCrush and costs a few nanoseconds per 128 bits
+ * without any system call.
+ */
+struct Philox4x32
+{
+    using Counter = std::array<std::uint32_t, 4>;   ///< 128-bit counter
+    using Key     = std::array<std::uint32_t, 2>;   ///< 64-bit key
+
+    /**
+     * @brief Random bits of one counter value.
+     * @param counter Counter
+     * @param key Key
+     * @return Four independent uniformly distributed 32-bit words
+     */
+    static constexpr Counter generate(Counter counter, Key key)
+    {
+        for (int round = 0; round < ROUNDS; ++round)
+        {
+            if (round > 0)
+            {
+                key[0] += W0;
+                key[1] += W1;
+            }
+
+            const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * counter[0];
+            const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * counter[2];
+
+            counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<std::uint32_t>(p1),
+                       static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<std::uint32_t>(p0)};
+        }
+        return counter;
+    }
+
+private:
+    static constexpr int ROUNDS = 10;
+    static constexpr std::uint32_t M0 = 0xD2511F53;     ///< Round multipliers
+    static constexpr std::uint32_t M1 = 0xCD9E8D57;
+    static constexpr std::uint32_t W0 = 0x9E3779B9;     ///< Key schedule (golden ratio, sqrt(3) - 1)
+    static constexpr std::uint32_t W1 = 0xBB67AE85;
+};
+
+/**
+ * @brief Position of a @ref NoiseStream, as stored in a checkpoint.
+ */
+struct NoiseStreamState
+{
+    std::uint64_t block = 0;        ///< Number of blocks generated so far
+    std::uint32_t position = 0;     ///< Next value within the current block
+};
+
+/**
+ * @brief Reproducible stream of standard normal samples.
+ *
+ * The stream is identified by a seed (Philox key) and a stream id (upper
+ * half of the Philox counter). The lower half numbers the blocks and the
+ * Philox calls within a block. Give every consumer its own stream id: its noise then depends only
+ * on (seed, stream id) and not on how many values other consumers draw or on
+ * which thread they run. This keeps Monte Carlo runs reproducible under any
+ * parallel schedule.
+ *
+ * Samples are generated @ref BLOCK_SIZE at a time with the ziggurat method
+ * (Marsaglia and Tsang, 128 layers, with Doornik's base strip). About 99 % of
+ * the samples cost 64 random bits, a multiplication and a comparison; only
+ * the wedges and the tail evaluate exp/log. A draw is then an array load.
+ */
+class NoiseStream
+{
+public:
+    /// Samples generated per refill; 512 bytes of buffer per stream
+    static constexpr std::size_t BLOCK_SIZE = 64;
+
+    /**
+     * @brief Constructor
+     * @param seed Seed of the run
+     * @param stream Id of this stream within the run
+     */
+    NoiseStream(std::uint64_t seed, std::uint64_t stream)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+          stream_(stream)
+    {}
+
+    /**
+     * @brief Next standard normal sample, N(0, 1)
+     * @return Sample
+     */
+    double gaussian()
+    {
+        if (position_ == BLOCK_SIZE)
+        {
+            fill(block_++);
+            position_ = 0;
+        }
+        return buffer_[position_++];
+    }
+
+    /// @return Current position for a checkpoint
+    NoiseStreamState state() const
+    {
+        return {block_, static_cast<std::uint32_t>(position_)};
+    }
+
+    /**
+     * @brief Continues the stream at a position captured by @ref state.
+     * @param s Stream position
+     */
+    void setState(const NoiseStreamState& s)
+    {
+        block_    = s.block;
+        position_ = s.position < BLOCK_SIZE ? s.position : BLOCK_SIZE;
+
+        if (block_ == 0)
+        {
+            position_ = BLOCK_SIZE;
+        }
+        else if (position_ < BLOCK_SIZE)
+        {
+            fill(block_ - 1);
+        }
+    }
+
+private:
+    static constexpr std::size_t LAYERS = 128;
+    static constexpr double ZIGGURAT_R = 3.442619855899;        ///< Start of the tail
+    static constexpr double ZIGGURAT_V = 9.91256303526217e-3;   ///< Area of each layer
+    static constexpr double TO_UNIT = 1.0 / 9007199254740992.0; ///< 2^-53
+
+    /**
+     * @brief Layer edges of the ziggurat.
+     *
+     * x[0] = V / f(R) is the width of the base strip including the tail,
+     * x[1] = R, x[LAYERS] = 0, with f(x) = exp(-x²/2) and f[i] = f(x[i]).
+     * ratio[i] = x[i + 1] / x[i] is the fast acceptance bound of layer i.
+     */
+    struct Ziggurat
+    {
+        std::array<double, LAYERS + 1> x{};
+        std::array<double, LAYERS + 1> f{};
+        std::array<double, LAYERS> ratio{};
+
+        Ziggurat()
+        {
+            x[0] = ZIGGURAT_V / std::exp(-0.5 * ZIGGURAT_R * ZIGGURAT_R);
+            x[1] = ZIGGURAT_R;
+            for (std::size_t i = 1; i < LAYERS - 1; ++i)
+            {
+                x[i + 1] = std::sqrt(-2.0 * std::log(ZIGGURAT_V / x[i] + std::exp(-0.5 * x[i] * x[i])));
+            }
+            x[LAYERS] = 0.0;
+
+            for (std::size_t i = 0; i <= LAYERS; ++i)
+            {
+                f[i] = std::exp(-0.5 * x[i] * x[i]);
+            }
+            for (std::size_t i = 0; i < LAYERS; ++i)
+            {
+                ratio[i] = x[i + 1] / x[i];
+            }
+        }
+    };
+
+    static const Ziggurat& ziggurat()
+    {
+        static const Ziggurat table;
+        return table;
+    }
+
+    /**
+     * @brief Sequential 64-bit words of one block.
+     *
+     * Block b uses the counters b · 2^32 + k, so the ziggurat may consume a
+     * varying number of words without overlapping the next block.
+     */
+    struct BlockBits
+    {
+        Philox4x32::Counter counter;
+        Philox4x32::Key key;
+        Philox4x32::Counter words{};
+        std::size_t used = 4;
+
+        std::uint64_t next()
+        {
+            if (used == 4)
+            {
+                words = Philox4x32::generate(counter, key);
+                ++counter[0];
+                used = 0;
+            }
+            const std::uint64_t bits = (static_cast<std::uint64_t>(words[used + 1]) << 32) | words[used];
+            used += 2;
+            return bits;
+        }
+
+        /// @return Uniform in (0, 1], safe for a logarithm
+        double open() { return ((next() >> 11) + 1) * TO_UNIT; }
+    };
+
+    /**
+     * @brief Generates block @p block of the stream into the buffer.
+     * @param block Block index
+     */
+    void fill(std::uint64_t block)
+    {
+        const Ziggurat& z = ziggurat();
+        BlockBits bits{{0, static_cast<std::uint32_t>(block),
+                        static_cast<std::uint32_t>(stream_), static_cast<std::uint32_t>(stream_ >> 32)},
+                       key_};
+
+        for (std::size_t n = 0; n < BLOCK_SIZE; ++n)
+        {
+            for (;;)
+            {
+                // Low 7 bits select the layer, the upper 53 bits give u in [-1, 1)
+                const std::uint64_t w = bits.next();
+                const std::size_t i   = w & (LAYERS - 1);
+                const double u        = 2.0 * ((w >> 11) * TO_UNIT) - 1.0;
+                const double x        = u * z.x[i];
+
+                // Inside the rectangle of the layer
+                if (std::abs(u) < z.ratio[i])
+                {
+                    buffer_[n] = x;
+                    break;
+                }
+
+                if (i == 0)
+                {
+                    // Tail beyond R
+                    double t, y;
+                    do
+                    {
+                        t = -std::log(bits.open()) / ZIGGURAT_R;
+                        y = -std::log(bits.open());
+                    } while (y + y < t * t);
+                    buffer_[n] = u < 0.0 ? -(ZIGGURAT_R + t) : ZIGGURAT_R + t;
+                    break;
+                }
+
+                // Wedge between the rectangle and the density
+                const double fy = z.f[i] + bits.open() * (z.f[i + 1] - z.f[i]);
+                if (fy < std::exp(-0.5 * x * x))
+                {
+                    buffer_[n] = x;
+                    break;
+                }
+            }
+        }
+    }
+
+    Philox4x32::Key key_;                       ///< Key derived from the seed
+    std::uint64_t stream_;                      ///< Stream id, upper counter half
+    std::uint64_t block_ = 0;                   ///< Number of blocks generated
+    std::size_t position_ = BLOCK_SIZE;         ///< Next sample in buffer_
+    std::array<double, BLOCK_SIZE> buffer_{};   ///< Current block of samples
+};
+
+#endif // PHILOX_H
@@ -2,13 +2,16 @@
 #define PHYSICS_H
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "environmentConfig.h"
 #include "vector3.h"
 #include "spacemath.h"
 #include "Physics/iPhysicsModel.h"
+#include "Physics/iPerturbation.h"
 #include "Integrators/iIntegrator.h"
-#include "Sensory_Perception/iSensor.h"
+#include "Sensory_Perception/sensorModel.h"
 
 /**
  * @class physics
@@ -40,12 +43,13 @@ private:
     spacemath math;
     std::shared_ptr<IPhysicsModel> model_;
     std::shared_ptr<IIntegrator> integrator_;
-    std::shared_ptr<ISensor> sensor_;
+    std::shared_ptr<SensorModel> sensor_;
+    std::vector<std::shared_ptr<const IPerturbation>> perturbations_;
 public:
     /**
      * @brief Constructor
      */
-    physics(std::shared_ptr<IPhysicsModel> model, std::shared_ptr<IIntegrator> integrator, std::shared_ptr<ISensor> sensor) : model_(model), integrator_(integrator), sensor_(sensor) {};
+    physics(std::shared_ptr<IPhysicsModel> model, std::shared_ptr<IIntegrator> integrator, std::shared_ptr<SensorModel> sensor) : model_(model), integrator_(integrator), sensor_(sensor) {};
 
     /**
      * @brief Destructor
@@ -56,15 +60,16 @@ public:
      * @brief Computes the current acceleration via the active physics model.
      *
      * Wrapper function delegating the calculation to the configured
-     * IPhysicsModel implementation.
+     * IPhysicsModel implementation. All registered perturbations are added.
      *
      * @param thrust    Current thrust force magnitude.
      * @param mass      Current spacecraft mass.
      * @param thrustDir Normalized thrust direction vector.
      * @param pos       Current position vector.
+     * @param t         Simulation time [s], used by time dependent perturbations.
      * @return Resulting acceleration vector.
      */
-    Vector3 computeAcc(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const;
+    Vector3 computeAcc(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust, double t = 0.0) const;
 
     /**
      * @brief Integrates velocity using the configured integrator.
@@ -128,6 +133,27 @@ public:
      * @see Vector3
      */
     double computeGLoad(const Vector3& totalAcceleration, const Vector3& gravityAcceleration, bool isLanded);
+
+    /**
+     * @brief Replaces the active physics model.
+     * @param model New model, e.g. a higher fidelity gravity field
+     */
+    void setModel(std::shared_ptr<IPhysicsModel> model);
+
+    /**
+     * @brief Adds a perturbation on top of the physics model.
+     * @param perturbation E.g. third-body tides
+     */
+    void addPerturbation(std::shared_ptr<const IPerturbation> perturbation);
+
+    /**
+     * @brief Gravitational parameter if unpowered motion is a pure two-body problem.
+     *
+     * True when the model is a point-mass field and no perturbations are registered.
+     *
+     * @return μ [m³/s²], or std::nullopt if coasting has no closed-form solution.
+     */
+    std::optional<double> keplerianParameter() const;
 };
 
 #endif
@@ -1,8 +1,12 @@
 #ifndef QUATERNION_H
 #define QUATERNION_H
 
+#include "vector3.h"
+
+#include <cmath>
+
 /**
- * @class Quaternion
+ * @class QuaternionT
  * @brief Mathematical representation of a 3D rotation using unit quaternions.
  *
  * This class represents an orientation quaternion used to describe the
@@ -13,11 +17,18 @@
  * rotations without scaling. Any deviation from unit norm would lead to
  * non-orthogonal rotation matrices and unphysical behavior.
  *
- * The class is deliberately kept free of any physical or numerical integration
- * logic. It only encapsulates mathematical properties and guarantees internal
- * consistency. Time integration and dynamics are handled externally.
+ * The class is deliberately kept free of any physical logic. It provides the
+ * algebra needed by attitude propagation: Hamilton product, vector rotation,
+ * the exponential map and the kinematic update for a body angular rate.
+ *
+ * All functions are defined inline so that the per-step attitude update
+ * compiles down to a few dozen flops. Everything that does not need a square
+ * root or trigonometric function is constexpr.
+ *
+ * @tparam T Scalar type (float or double)
  */
-class Quaternion
+template<typename T>
+class QuaternionT
 {
 public:
     /**
@@ -26,7 +37,9 @@ public:
      * The identity quaternion represents zero rotation:
      * q = (1, 0, 0, 0)
      */
-    Quaternion();
+    constexpr QuaternionT()
+        : q0_(1), q1_(0), q2_(0), q3_(0)
+    {}
 
     /**
      * @brief Constructs a quaternion from its components and normalizes it.
@@ -39,19 +52,69 @@ public:
      * @param q2 Second vector component
      * @param q3 Third vector component
      */
-    Quaternion(double q0, double q1, double q2, double q3);
+    QuaternionT(T q0, T q1, T q2, T q3)
+        : q0_(q0), q1_(q1), q2_(q2), q3_(q3)
+    {
+        T qN = norm(q0, q1, q2, q3);
+
+        if (qN == T(0)) qN = T(1);
+        q0_ /= qN;
+        q1_ /= qN;
+        q2_ /= qN;
+        q3_ /= qN;
+    }
+
+    /**
+     * @brief Rotation by an angle about an axis (exponential map).
+     *
+     * \f[
+     * q = \exp\left(\tfrac{1}{2}\boldsymbol{\theta}\right)
+     *   = \left(\cos\tfrac{|\boldsymbol{\theta}|}{2},\;
+     *     \sin\tfrac{|\boldsymbol{\theta}|}{2}\,\hat{\boldsymbol{\theta}}\right)
+     * \f]
+     *
+     * Angles below 0.01 rad, which covers a simulation step at any
+     * realistic rate, use the Taylor series in the squared angle. They need
+     * neither a square root nor trigonometric functions and are exact to
+     * rounding down to a zero vector.
+     *
+     * @param rotationVector Rotation axis scaled by the angle [rad]
+     * @return Unit quaternion of the rotation
+     */
+    static QuaternionT exp(const Vector3T<T>& rotationVector)
+    {
+        const T angle2 = rotationVector.dot(rotationVector);
+
+        // c = cos(x/2), k = sin(x/2)/x; the first omitted terms are below x^6/46080
+        T c, k;
+        if (angle2 < T(1e-4))
+        {
+            c = T(1) - angle2 / T(8) + angle2 * angle2 / T(384);
+            k = T(0.5) - angle2 / T(48) + angle2 * angle2 / T(3840);
+        }
+        else
+        {
+            const T angle = std::sqrt(angle2);
+            c = std::cos(angle * T(0.5));
+            k = std::sin(angle * T(0.5)) / angle;
+        }
+        return QuaternionT(c, rotationVector.x * k, rotationVector.y * k, rotationVector.z * k, Unchecked{});
+    }
 
     /// @return Scalar component of the quaternion
-    double getQ0() const;
+    constexpr T getQ0() const { return q0_; }
 
     /// @return First vector component of the quaternion
-    double getQ1() const;
+    constexpr T getQ1() const { return q1_; }
 
     /// @return Second vector component of the quaternion
-    double getQ2() const;
+    constexpr T getQ2() const { return q2_; }
 
     /// @return Third vector component of the quaternion
-    double getQ3() const;
+    constexpr T getQ3() const { return q3_; }
+
+    /// @return Vector part (q1, q2, q3)
+    constexpr Vector3T<T> vector() const { return {q1_, q2_, q3_}; }
 
     /**
      * @brief Computes the Euclidean norm of a quaternion.
@@ -64,23 +127,129 @@ public:
      * @param q3 Third vector component
      * @return Quaternion norm
      */
-    double norm(double q0, double q1, double q2, double q3) const;
+    T norm(T q0, T q1, T q2, T q3) const
+    {
+        return std::sqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    }
+
+    /**
+     * @brief Rescales the quaternion to unit norm.
+     *
+     * Products of unit quaternions drift away from unit norm by rounding.
+     * Propagation calls this once per step.
+     */
+    void normalize()
+    {
+        T qN = norm(q0_, q1_, q2_, q3_);
+        q0_ /= qN;
+        q1_ /= qN;
+        q2_ /= qN;
+        q3_ /= qN;
+    }
+
+    // -------------------------------------------------------------------------
+    // Algebra
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Conjugate, the inverse rotation of a unit quaternion.
+     * @return (q0, -q1, -q2, -q3)
+     */
+    constexpr QuaternionT conjugate() const
+    {
+        return QuaternionT(q0_, -q1_, -q2_, -q3_, Unchecked{});
+    }
+
+    /**
+     * @brief Hamilton product, the composition of two rotations.
+     *
+     * For frame rotations, (q_IB * q_BC) maps C to I. The product of unit
+     * quaternions is unit up to rounding and is not renormalized here.
+     *
+     * @param o Right-hand factor
+     * @return this ⊗ o
+     */
+    constexpr QuaternionT operator*(const QuaternionT& o) const
+    {
+        return QuaternionT(
+            q0_ * o.q0_ - q1_ * o.q1_ - q2_ * o.q2_ - q3_ * o.q3_,
+            q0_ * o.q1_ + q1_ * o.q0_ + q2_ * o.q3_ - q3_ * o.q2_,
+            q0_ * o.q2_ - q1_ * o.q3_ + q2_ * o.q0_ + q3_ * o.q1_,
+            q0_ * o.q3_ + q1_ * o.q2_ - q2_ * o.q1_ + q3_ * o.q0_,
+            Unchecked{});
+    }
+
+    /**
+     * @brief Rotates a vector from the body frame to the inertial frame.
+     *
+     * Evaluates q ⊗ (0, v) ⊗ q* without forming the products:
+     * \f[
+     * \mathbf{v}' = \mathbf{v} + 2\mathbf{w} \times (\mathbf{w} \times \mathbf{v} + q_0 \mathbf{v})
+     * \f]
+     * with \f$\mathbf{w}\f$ the vector part. The identity quaternion returns
+     * @p v unchanged, bit for bit.
+     *
+     * @param v Vector in the body frame
+     * @return Vector in the inertial frame
+     */
+    constexpr Vector3T<T> rotate(const Vector3T<T>& v) const
+    {
+        const Vector3T<T> w = vector();
+        const Vector3T<T> t = w.cross(v) + v * q0_;
+        return v + w.cross(t) * T(2);
+    }
 
     /**
-     * @brief Normalizes a single quaternion component.
+     * @brief Rotates a vector from the inertial frame to the body frame.
+     * @param v Vector in the inertial frame
+     * @return Vector in the body frame
+     */
+    constexpr Vector3T<T> rotateInverse(const Vector3T<T>& v) const
+    {
+        return conjugate().rotate(v);
+    }
+
+    /**
+     * @brief Orientation after rotating with a constant body rate.
      *
-     * This helper function divides a quaternion component by the quaternion norm.
+     * Integrates the kinematic equation
+     * \f$\dot{q} = \tfrac{1}{2}\, q \otimes (0, \boldsymbol{\omega}_B)\f$
+     * exactly for constant \f$\boldsymbol{\omega}_B\f$ over @p dt, i.e.
+     * q ⊗ exp(ω_B·dt) with @ref exp, followed by a renormalization.
      *
+     * @param B_omega Angular velocity in the body frame [rad/s]
+     * @param dt Time step [s]
+     * @return Propagated orientation
      */
-    void normalize();
+    QuaternionT integrated(const Vector3T<T>& B_omega, T dt) const
+    {
+        QuaternionT q = *this * exp(B_omega * dt);
+        q.normalize();
+        return q;
+    }
+
 private:
+    /// Tag for the constructor that skips normalization
+    struct Unchecked {};
+
+    /**
+     * @brief Takes the components as they are. Only used where the result is
+     *        unit by construction (up to rounding).
+     */
+    constexpr QuaternionT(T q0, T q1, T q2, T q3, Unchecked)
+        : q0_(q0), q1_(q1), q2_(q2), q3_(q3)
+    {}
+
     /// Quaternion scalar component
-    double q0_;
+    T q0_;
 
     /// Quaternion vector components
-    double q1_;
-    double q2_;
-    double q3_;
+    T q1_;
+    T q2_;
+    T q3_;
 };
 
+using Quaternion  = QuaternionT<double>;    ///< Default quaternion type of the simulation
+using Quaternionf = QuaternionT<float>;     ///< Single precision quaternion for throughput paths
+
 #endif // QUATERNION_H
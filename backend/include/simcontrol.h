@@ -5,9 +5,17 @@
 #include "simDataStruct.h"
 #include "jsonConfigReader.h"
 #include "Control/inputArbiter.h"
+#include "Control/timeWarpGovernor.h"
+#include "Control/rateSchedule.h"
+#include "Checkpoint/simCheckpoint.h"
+#include "Sensory_Perception/sensorSuite.h"
+#include "Navigation/navigationFilter.h"
+#include "threadPool.h"
+#include "Terrain/iTerrainModel.h"
 
 #include <optional>
 #include <memory>
+#include <vector>
 #include <nlopt.h>
 
 /**
@@ -28,23 +36,58 @@
  * In short, SimControl decides *who controls the spacecraft* and *when the simulation advances*,
  * while the actual physics and state changes are handled by the spacecraft and its subsystems.
  *
+ * Multiple landers:
+ * The simulation manages a collection of landers which are stepped together in one loop.
+ * Every lander has its own configuration, arbiter, autopilot, controller and telemetry
+ * channel, while the environment model (gravity field) is created once and shared.
+ * Lander 0 is the lander created by initialize() and is the one addressed by the
+ * single-lander API (runSimulation return value, receiveCommandFromFrontEnd(cmd), ...).
+ * Rate groups:
+ * Within a runSimulation() call, the landers advance in ticks of the physics period.
+ * Autopilot, propulsion and sensors run every n-th tick according to a static
+ * @ref RateSchedule; telemetry is published once per call. Time that does not
+ * fill a whole tick is carried over to the next call.
+ *
+ * When the number of landers reaches @ref PARALLEL_LANDER_THRESHOLD, the per-lander
+ * work of a step is spread across a thread pool.
+ *
  */
 class simcontrol
 {
 private:
+    /**
+     * @brief Everything owned by one lander of the simulation
+     */
+    struct LanderInstance
+    {
+        customSpacecraft config;                      ///< Config for the spacecraft provided by json config
+        std::unique_ptr<spacecraft>       craft;      ///< Spacecraft with specs and integrity
+        std::unique_ptr<InputArbiter>     arbiter;    ///< Arbiter for input commands
+        std::unique_ptr<IAutopilot>       autopilot;  ///< Virtual autopilot instance
+        std::unique_ptr<IController>      controller; ///< Virtual controller instance
+        std::unique_ptr<SensorSuite>      sensors;    ///< Noisy navigation sensors
+        std::unique_ptr<NavigationFilter> navigation; ///< State estimate fed to the autopilot
+        simData telemetry;                            ///< Telemetry of the last completed step
+    };
+
     //***********************************************************
     //*************        Members                   ************
     //***********************************************************
-    std::unique_ptr<spacecraft>     landerSpacecraft;   ///< Spacecraft with specs and integrity
-    std::unique_ptr<InputArbiter>   inputArbiter_;      ///< Arbiter for input commands
-    std::unique_ptr<IAutopilot>     autopilot_;         ///< Virtual autopilot instance
-    std::unique_ptr<IController>    controller_;        ///< Virtual controller instance
+    std::vector<LanderInstance> landers_;           ///< All landers of the simulation. Index is the lander id
+    std::shared_ptr<IPhysicsModel> environment_;    ///< Environment model shared by all landers
+    std::shared_ptr<const ITerrainModel> terrain_;  ///< Terrain shared by all landers, nullptr = spherical
+    std::vector<std::shared_ptr<const IPerturbation>> perturbations_;  ///< Perturbations applied to all landers
+    std::unique_ptr<ThreadPool> threadPool_;        ///< Created on demand for large lander counts
+    TimeWarpGovernor warpGovernor_;                 ///< Limits time warp to safe flight phases
+    RateSchedule schedule_;                         ///< Rates of autopilot, propulsion, physics and sensors
+    std::uint64_t tick_ = 0;                        ///< Physics ticks executed so far
+    double pendingTime_ = 0.0;                      ///< [s] Time requested but not yet a whole tick
 
     std::string jsonConfigString;                   ///< String with raw space config data provided by frontend
-    customSpacecraft landerMoon1;                   ///< Config for used spacecraft provided by json config
     EnvironmentConfig config_;                      ///< Config struct for moon environment
     ControlCommand cmd_;                            ///< Command structure for autopilot
     bool resetRequested;                            ///< Represents user desire to reset simulation
+    std::uint64_t sensorSeed_ = 0;                  ///< Seed of the sensor noise of all landers
 
     // Inital data
     double initialTime;                             ///< [s] Initial simulation time
@@ -53,9 +96,54 @@ private:
     //*************    Memberfuctions                ************
     //***********************************************************
     /**
-     * @brief Build instances necessary for the simulation
+     * @brief Build instances necessary for one lander of the simulation
+     * @param landerConfig                          ///< Config of the new lander
+     * @param landerId                              ///< Id of the new lander, selects its sensor noise streams
+     * @return Fully initialized lander
+     */
+    LanderInstance buildLander(const customSpacecraft& landerConfig, std::size_t landerId);
+
+    /**
+     * @brief Returns the lander with the given id
+     * @throws std::out_of_range If no lander with this id exists
+     */
+    LanderInstance& lander(std::size_t id);
+    const LanderInstance& lander(std::size_t id) const;
+
+    /**
+     * @brief Advances a single lander by a number of physics ticks
+     *
+     * Runs the tasks due in each tick according to the rate schedule and
+     * publishes telemetry once at the end.
+     * Touches only the given lander, so different landers may be stepped concurrently.
+     * @param l                                     ///< Lander to advance
+     * @param firstTick                             ///< Global number of the first tick
+     * @param ticks                                 ///< Number of ticks
+     */
+    void stepLander(LanderInstance& l, std::uint64_t firstTick, std::uint64_t ticks);
+
+    /**
+     * @brief Checks whether a lander may be advanced analytically
+     *
+     * Requires manual control with zero commanded thrust, idle engines, a point-mass
+     * field and an altitude above the stop altitude.
+     * @param l                                     ///< Lander to check
+     * @param stopAltitude                          ///< [m] Altitude above the terrain at which coasting ends
      */
-    void buildSimulationEnvironment(double t);
+    bool canFastForward(LanderInstance& l, double stopAltitude);
+
+    /**
+     * @brief Time until a coasting lander descends to an altitude above the terrain
+     *
+     * The stop radius is the terrain height below the lander plus @p stopAltitude. The
+     * height is then re-read below the predicted arrival point and the stop radius raised
+     * if the terrain there is higher, until it settles. Relief between the current and
+     * the arrival point is not sampled; @ref FAST_FORWARD_TERRAIN_MARGIN covers it.
+     * @param l                                     ///< Coasting lander
+     * @param stopAltitude                          ///< [m] Altitude above the terrain, margin included
+     * @return [s] Time of the crossing, 0 if the stop radius does not settle, or infinity
+     */
+    double timeToTerrainStop(const LanderInstance& l, double stopAltitude) const;
 
     /**
      * @brief Load json config out of string provided from frontend which defines spacecraft parameters
@@ -70,13 +158,13 @@ private:
      * @brief Sets target thrust
      * @param thrustPercent [%]
      */
-    void setTargetMainEngineThrust(const double& thrustPercent = 0, const double& thrustInNewton = 0);
+    void setTargetMainEngineThrust(LanderInstance& l, const double& thrustPercent = 0, const double& thrustInNewton = 0);
 
     /**
      * @brief Set RCS Thrust
      * @param Vector3 translation with thrust in cartasian coordinates within the principle ENU (East North Up)
      */
-    void setTargetRCSThrust(const Vector3 &ENU_translation);
+    void setTargetRCSThrust(LanderInstance& l, const Vector3 &ENU_translation);
 
     /**
      * @brief Process commands
@@ -87,17 +175,24 @@ private:
      * at the same time.
      *
      */
-    void processCommands();
+    void processCommands(LanderInstance& l);
 
     /**
      * @brief orchestrate autopilot
+     * @param l Lander the autopilot belongs to
      * @param Current Spacecraft state. Autopilot is only active, when spacecraft state is operational
      * @param engineNr [-] Number of engine that will be controlled automatically
      * @param dt [s] Discrete timestep
      */
-    void runAutopilot(const SpacecraftState& currentSpacecraftstate, const int &engineNr, const double& dt);
+    void runAutopilot(LanderInstance& l, const SpacecraftState& currentSpacecraftstate, const int &engineNr, const double& dt);
 
 public:
+    /// Lander count from which a step is distributed across the thread pool
+    static constexpr std::size_t PARALLEL_LANDER_THRESHOLD = 8;
+
+    /// [m] Added to the fast-forward stop altitude when terrain is set, for relief along the ground track
+    static constexpr double FAST_FORWARD_TERRAIN_MARGIN = 2000.0;
+
     //***********************************************************
     //*************    Memberfuctions                ************
     //***********************************************************
@@ -116,10 +211,72 @@ public:
 
     /**
      * @brief Initializes simulation environment and spacecraft config
+     *
+     * Removes all existing landers and creates lander 0 from the given config.
      * @param jsonConfigStr                         ///< String with spacecraft config data
      */
     void initialize(const std::string& jsonConfigStr);
 
+    /**
+     * @brief Adds another lander to the simulation
+     *
+     * The lander starts from the initial state of its config and is stepped together
+     * with all other landers from the next runSimulation() call on.
+     * @param jsonConfigStr                         ///< String with spacecraft config data
+     * @return Id of the new lander
+     */
+    std::size_t addLander(const std::string& jsonConfigStr);
+
+    /**
+     * @brief Returns the number of landers in the simulation
+     */
+    std::size_t landerCount() const;
+
+    /**
+     * @brief Sets the terrain for all current and future landers
+     * @param terrain Surface height model, nullptr for a spherical moon
+     */
+    void setTerrainModel(std::shared_ptr<const ITerrainModel> terrain);
+
+    /**
+     * @brief Sets the execution rates of autopilot, propulsion, physics and sensors
+     *
+     * Takes effect with the next tick. Defaults to 50 / 500 / 1000 / 200 Hz.
+     * @param rates                                 ///< Task rates, each dividing the physics rate
+     * @throws std::runtime_error If a rate does not divide the physics rate
+     */
+    void setTaskRates(const TaskRates& rates);
+
+    /**
+     * @brief Returns the active rate schedule
+     */
+    const RateSchedule& getSchedule() const;
+
+    /**
+     * @brief Sets the seed of the sensor noise
+     *
+     * Applies to landers added afterwards; call before initialize(). The noise
+     * of a lander depends only on this seed and its id, so a run is reproducible
+     * however the landers are distributed across threads.
+     * @param seed                                  ///< Seed of the run
+     */
+    void setSensorSeed(std::uint64_t seed);
+
+    /**
+     * @brief Replaces the shared environment model for all current and future landers
+     *
+     * Used to select a higher fidelity gravity field (e.g. SphericalHarmonicGravityModel).
+     * The model is evaluated concurrently when landers are stepped in parallel.
+     * @param model Physics model
+     */
+    void setEnvironmentModel(std::shared_ptr<IPhysicsModel> model);
+
+    /**
+     * @brief Adds a perturbation (e.g. ThirdBodyPerturbation) to all current and future landers
+     * @param perturbation Perturbation, evaluated concurrently when landers are stepped in parallel
+     */
+    void addPerturbation(std::shared_ptr<const IPerturbation> perturbation);
+
     /**
      * @brief Instances the logging action and provides filepath for logging file
      */
@@ -130,10 +287,83 @@ public:
      *
      * This function owns the states of simulation. It knows all physical, environmental and spacecraft conditions.
      * All states are calculated by given timesteps from worker.
-     * @param dt                                    ///< [s] discrete timestep
+     * All landers are advanced; their telemetry is available via getTelemetry().
+     * The span is executed as whole physics ticks of the rate schedule; a remainder
+     * below one tick is carried over to the next call.
+     * @param dt                                    ///< [s] Simulated time to advance
+     * @return Telemetry of lander 0
      */
     simData runSimulation(const double dt);
 
+    /**
+     * @brief Advances a coasting simulation analytically to the next event
+     *
+     * When every lander is in unpowered flight in a point-mass field, all landers are
+     * moved along their Kepler orbits in a single step, so the cost does not depend on
+     * the coast duration. The jump ends at the earliest of
+     * - @p maxDuration, e.g. the time of the next commanded burn,
+     * - the first lander descending to @p stopAltitude (touchdown for 0).
+     *
+     * Nothing is advanced if any lander is under autopilot control, has a thrust
+     * command or a running engine, or the environment has non-central terms; the caller
+     * continues with runSimulation() in that case. @p stopAltitude is measured above
+     * the terrain, like spacecraft::getAltitude(). With a terrain model the jump stops
+     * @ref FAST_FORWARD_TERRAIN_MARGIN higher, so the rest of the descent is stepped and
+     * contact is detected on the real surface (see timeToTerrainStop()).
+     *
+     * @param maxDuration                           ///< [s] Upper bound of the jump
+     * @param stopAltitude                          ///< [m] Altitude above the terrain at which coasting ends
+     * @return [s] Simulation time actually advanced, 0 if no lander could coast
+     */
+    double fastForward(double maxDuration, double stopAltitude = 0.0);
+
+    /**
+     * @brief Advances the simulation by a time span using bounded sub-steps
+     *
+     * Used for time warp: the span of one frame is split into runSimulation() calls no
+     * longer than @p maxStep. Each call integrates at the physics tick, so warp never
+     * coarsens the integration. Phases in which all landers coast are jumped
+     * analytically (see fastForward()).
+     * @param duration                              ///< [s] Simulated time to advance
+     * @param maxStep                               ///< [s] Largest span per runSimulation() call
+     * @return Telemetry of lander 0 after the last step
+     */
+    simData advanceSimulation(double duration, double maxStep);
+
+    /**
+     * @brief Returns the time warp the current flight situation allows
+     *
+     * Evaluates the TimeWarpGovernor for every lander and returns the most
+     * restrictive level.
+     * @param requested                             ///< [-] Warp requested by the pilot
+     * @return [-] Allowed warp level
+     */
+    double allowedTimeWarp(double requested) const;
+
+    /**
+     * @brief Sets the limits of the time warp governor
+     * @param limits                                ///< Thrust, G-load and altitude limits
+     */
+    void setTimeWarpLimits(const TimeWarpLimits& limits);
+
+    /**
+     * @brief Returns the telemetry of a lander from the last completed step
+     * @param landerId                              ///< Id returned by addLander (0 for the initial lander)
+     */
+    simData getTelemetry(std::size_t landerId) const;
+
+    /**
+     * @brief Returns the sensor measurements of a lander from the last completed step
+     * @param landerId                              ///< Id returned by addLander (0 for the initial lander)
+     */
+    const SensorReadings& getSensorReadings(std::size_t landerId) const;
+
+    /**
+     * @brief Returns the navigation estimate the autopilot of a lander works with
+     * @param landerId                              ///< Id returned by addLander (0 for the initial lander)
+     */
+    NavigationEstimate getNavigationEstimate(std::size_t landerId) const;
+
     /**
      * @brief Receives a control command from the frontend.
      *
@@ -150,6 +380,13 @@ public:
      */
     void receiveCommandFromFrontEnd(const ControlCommand& userCmd);
 
+    /**
+     * @brief Receives a control command from the frontend for a specific lander.
+     * @param landerId Id of the addressed lander
+     * @param userCmd The control command provided by the user interface.
+     */
+    void receiveCommandFromFrontEnd(std::size_t landerId, const ControlCommand& userCmd);
+
     /**
      * @brief Receives a control command from the autopilot system.
      *
@@ -183,6 +420,67 @@ public:
      * @brief Takes over command from autopilot & convert them into command struct
      */
     void setAutoPilotCommand(const double &autoThrust);
+
+    /**
+     * @brief Returns the current simulation time
+     * @return Simulation time [s]
+     */
+    double getSimulationTime() const;
+
+    /**
+     * @brief Returns the current simulation data without advancing the simulation
+     *
+     * Used to refresh the frontend after a restore.
+     * @return SimData struct of the current state of lander 0
+     */
+    simData getSimulationData() const;
+
+    // -------------------------------------------------------------------------
+    // Checkpoint / Restore
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Captures the complete dynamic simulation state.
+     *
+     * Covers, for every lander, spacecraft state vector, integrity and sim time,
+     * all engine states and tank masses, the controller memory, the autopilot
+     * descent mode, the arbiter commands, the sensor noise streams and biases and
+     * the navigation filter.
+     *
+     * @return Versioned checkpoint blob
+     */
+    SimCheckpoint checkpoint() const;
+
+    /**
+     * @brief Captures the simulation state into an existing blob.
+     *
+     * Fast in-memory path: the blob is cleared but keeps its capacity, so
+     * reusing the same blob does not allocate after the first call.
+     *
+     * @param blob Destination blob, overwritten
+     */
+    void checkpoint(SimCheckpoint& blob) const;
+
+    /**
+     * @brief Restores a state captured by checkpoint().
+     *
+     * The simulation must have been initialized with the same landers and
+     * spacecraft configurations the checkpoint was taken from.
+     *
+     * All sections are decoded before any state is changed, so a blob that is
+     * rejected leaves the simulation as it was.
+     *
+     * @param blob Checkpoint blob
+     * @throws std::runtime_error If the blob is not a valid checkpoint of this layout
+     */
+    void restore(const SimCheckpoint& blob);
+
+    /**
+     * @brief Restores a state captured by checkpoint() from raw memory.
+     * @param data Pointer to the checkpoint bytes
+     * @param size Size of the checkpoint [bytes]
+     */
+    void restore(const std::uint8_t* data, std::size_t size);
 };
 
 #endif
@@ -0,0 +1,169 @@
+#ifndef SIMULATIONLOOP_H
+#define SIMULATIONLOOP_H
+
+#include "simcontrol.h"
+#include "spscRing.h"
+#include "tripleBuffer.h"
+#include "Checkpoint/snapshotRingBuffer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Request sent from the host (UI) to the simulation thread.
+ */
+struct SimCommand
+{
+    enum class Type : std::uint8_t
+    {
+        Start,          ///< Build the simulation from @ref config, or resume after Pause
+        Pause,          ///< Halt stepping, keep the simulation
+        Stop,           ///< Halt stepping and reset
+        Control,        ///< Replace the front-end command with @ref control
+        Rewind,         ///< Rewind by @ref value seconds
+        TimeWarp        ///< Request time warp @ref value
+    };
+
+    Type type = Type::Control;
+    ControlCommand control;         ///< Control: pilot input and autopilot flag
+    double value = 0.0;             ///< Rewind: [s] span, TimeWarp: [-] factor
+    std::string config;             ///< Start: spacecraft JSON, empty to reuse the last one
+};
+
+/**
+ * @brief Notification from the simulation thread that must not be lost.
+ */
+struct SimEvent
+{
+    enum class Type : std::uint8_t
+    {
+        Error,              ///< @ref message describes a failed start, step or rewind
+        TimeWarpChanged     ///< @ref value is the new effective warp
+    };
+
+    Type type = Type::Error;
+    double value = 0.0;
+    std::string message;
+};
+
+/**
+ * @brief Telemetry frame published by the simulation thread.
+ */
+struct SimFrame
+{
+    std::uint64_t frame = 0;        ///< Increases with every published frame
+    double time = 0.0;              ///< [s] Simulation time
+    double effectiveWarp = 1.0;     ///< [-] Applied time warp
+    bool stopped = false;           ///< Published by Stop; data is not meaningful
+    simData data{};                 ///< Telemetry of lander 0
+};
+
+/**
+ * @class SimulationLoop
+ * @brief Runs the simulation on a dedicated thread, independent of any UI toolkit.
+ *
+ * The thread wakes every frame period, applies the queued commands, advances
+ * simcontrol by one frame (times the allowed warp) and publishes the
+ * telemetry. Three lock-free channels connect it to the host:
+ *
+ * - @ref send: SPSC ring of @ref SimCommand into the loop
+ * - @ref latestFrame: @ref TripleBuffer slot with the newest @ref SimFrame
+ * - @ref pollEvent: SPSC ring of @ref SimEvent out of the loop
+ *
+ * The host and the simulation never take a common lock, so a slow UI frame
+ * cannot stall the physics and vice versa. Each channel has exactly one
+ * producer and one consumer thread.
+ *
+ * The loop owns the rewind history and the time warp state.
+ * It does not catch up on overruns: a late frame moves the schedule instead of
+ * running frames back to back.
+ */
+class SimulationLoop
+{
+public:
+    static constexpr std::size_t COMMAND_CAPACITY = 256;
+    static constexpr std::size_t EVENT_CAPACITY = 64;
+
+    /**
+     * @brief Starts the simulation thread; it idles until a Start command arrives
+     * @param framePeriod Real time between two frames, also the simulated time per frame at warp 1 [s]
+     */
+    explicit SimulationLoop(double framePeriod = 0.05);
+
+    /**
+     * @brief Stops and joins the simulation thread
+     */
+    ~SimulationLoop();
+
+    SimulationLoop(const SimulationLoop&) = delete;
+    SimulationLoop& operator=(const SimulationLoop&) = delete;
+
+    /**
+     * @brief Queues a command; host thread only
+     * @param command Command
+     * @return False if the queue is full and the command was dropped
+     */
+    bool send(SimCommand command);
+
+    /**
+     * @brief Newest telemetry; host thread only
+     * @param out Receives the frame if a new one was published
+     * @return True if @p out was updated
+     */
+    bool latestFrame(SimFrame& out);
+
+    /**
+     * @brief Next notification; host thread only
+     * @param out Receives the event
+     * @return False if no event is pending
+     */
+    bool pollEvent(SimEvent& out);
+
+    /// @return Frame period [s]
+    double framePeriod() const;
+
+private:
+    /// Thread main loop
+    void run();
+
+    /// Applies one command on the simulation thread
+    void apply(SimCommand& command);
+
+    /// Advances the simulation by one frame
+    void step();
+
+    /// Publishes the current telemetry
+    void publish(bool stopped);
+
+    /// Queues an event, dropped if the host does not drain them
+    void notify(SimEvent::Type type, double value, const std::string& message = {});
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    const double framePeriod_;                              ///< [s]
+
+    SpscRing<SimCommand, COMMAND_CAPACITY> commands_;       ///< Host → loop
+    SpscRing<SimEvent, EVENT_CAPACITY> events_;             ///< Loop → host
+    TripleBuffer<SimFrame> telemetry_;                      ///< Loop → host, latest value
+
+    // --- Simulation thread only ---
+    std::unique_ptr<simcontrol> sim_;
+    SnapshotRingBuffer snapshots_{600, 1.0};                ///< Rewind history: one snapshot per simulated second for 10 minutes
+    ControlCommand frontEnd_;                               ///< Latest pilot input
+    std::string config_;                                    ///< Spacecraft JSON of the last Start
+    bool running_ = false;
+    bool paused_ = false;
+    double requestedWarp_ = 1.0;                            ///< [-]
+    double effectiveWarp_ = 1.0;                            ///< [-]
+    std::uint64_t frame_ = 0;
+
+    std::atomic<bool> quit_{false};
+    std::thread thread_;                                    ///< Started last, after all members exist
+};
+
+#endif // SIMULATIONLOOP_H
@@ -14,9 +14,39 @@
 #include "Automation/iautopilot.h"
 #include "Controller/iController.h"
 #include "Thrust/EngineConfig.h"
+#include "Checkpoint/simCheckpoint.h"
+#include "Terrain/iTerrainModel.h"
+#include "floatingOrigin.h"
+#include "Integrators/attitudePropagator.h"
 
 #include <memory>
 
+/**
+ * @brief Dynamic spacecraft state as stored in a simulation checkpoint.
+ *
+ * Propulsion state (engines, tanks) is written separately by @ref Thrust.
+ */
+struct SpacecraftCheckpoint
+{
+    StateVector state;                  ///< Full translational and rotational state
+    Vector3 localPosition;              ///< [m] Position relative to the floating origin
+    Vector3 origin;                     ///< [m] Floating origin
+    SpacecraftState spacecraftState = SpacecraftState::Operational;
+    double spacecraftIntegrity = 1.0;   ///< [%] Current integrity
+    double totalMass = 0.0;             ///< [kg] Total mass
+    double time = 0.0;                  ///< [s] Simulation time
+    double GLoad = 0.0;                 ///< [m/s²] Last G-load
+};
+
+/**
+ * @brief Spacecraft and propulsion section of a checkpoint, read but not yet applied.
+ */
+struct SpacecraftCheckpointSection
+{
+    SpacecraftCheckpoint spacecraft;    ///< Dynamic spacecraft state
+    ThrustCheckpoint propulsion;        ///< Engine and tank state
+};
+
 /**
  * @class spacecraft
  * @brief Represents a spacecraft with a main engine and fuel.
@@ -42,12 +72,16 @@ private:
      */
     ///@{
     std::unique_ptr<physics> physics_;          ///< Physics engine handling lander motion
+    std::shared_ptr<const ITerrainModel> terrain_;  ///< Surface height model used for ground contact
     Thrust thrustOrchestration;                 ///< Orchestrator class for engine simulation
 
     StateVector state_;                     ///< Encapsulates the complete translational and rotational state of the spacecraft and is single source of thruth
+    FloatingOrigin origin_;                 ///< Local origin near the spacecraft, see @ref FloatingOrigin
+    Vector3 localPosition_;                 ///< [m] Integrated position relative to origin_. state_.I_Position = origin + localPosition_
     EnvironmentConfig environmentConfig_;   ///< [-] Environment config struct with constant parameters.
     SpacecraftState spacecraftState_;       ///< State of spacecraft
     customSpacecraft landerMoon;            ///< [] Parameters which defines spacecraft. This are filled by json config data.
+    AttitudePropagator attitude_;           ///< Rotational dynamics from the configured moments of inertia
 
     double totalMass;               ///< [kg] Total mass of spacecraft.
     double dt = 0;                  ///< [s] Time steps. Provided by updateTime.
@@ -143,6 +177,15 @@ private:
      */
     void setPosition(const Vector3& pos);
 
+    /**
+     * @brief Update position from the local frame
+     *
+     * Rebases the floating origin if necessary and refreshes the absolute
+     * position in the state vector.
+     * @param 3D Vector relative to the floating origin [m]
+     */
+    void setLocalPosition(const Vector3& localPos);
+
     /**
      * @brief Sets velocity of spacecraft
      * @param 3D Vector with velocities in three dimensions [m/s]
@@ -210,6 +253,9 @@ private:
     void applyLandingDamage(double impactVelocity);
 
 public:
+    /// [N] Engine tail-off below this thrust counts as idle (the throttle lag decays only asymptotically)
+    static constexpr double IDLE_THRUST = 1.0;
+
     /**
      * @brief Constructs a spacecraft using parameters loaded from a configuration object.
      *
@@ -252,6 +298,19 @@ public:
      */
     spacecraft(customSpacecraft lMoon);
 
+    /**
+     * @brief Constructor with an externally owned physics model
+     *
+     * Used when several spacecraft fly in the same environment: the model is
+     * created once by the simulation and shared by all landers. The model must
+     * be stateless with respect to the spacecraft (pure function of position,
+     * velocity, mass and thrust), since it may be evaluated concurrently.
+     *
+     * @param lMoon Spacecraft configuration
+     * @param sharedModel Physics model shared with other spacecraft
+     */
+    spacecraft(customSpacecraft lMoon, std::shared_ptr<IPhysicsModel> sharedModel);
+
     /**
      * @brief Destructor
      *
@@ -283,6 +342,21 @@ public:
      */
     void updateStep(double dt);
 
+    /**
+     * @brief Advances engines and tank masses; first half of updateStep
+     *
+     * Lets the simulation controller run propulsion at a lower rate than
+     * the dynamics. Thrust then stays constant between two calls.
+     * @param dt Time since the last propulsion update [s]
+     */
+    void updatePropulsion(double dt);
+
+    /**
+     * @brief Advances time, ground contact, translation and attitude; second half of updateStep
+     * @param dt Simulation time step [s]
+     */
+    void updateDynamics(double dt);
+
     /**
      * @brief Updates spacecraft integrity in case of damage
      * 
@@ -297,6 +371,18 @@ public:
      */
     void updateSpacecraftIntegrity();
 
+    /**
+     * @brief Advances an unpowered spacecraft analytically.
+     *
+     * Propagates position and velocity on the Kepler orbit and advances the
+     * simulation time by @p duration in one call, independent of its length.
+     * Engines, tanks and integrity are unchanged during a coast.
+     *
+     * @param duration Coast time [s]
+     * @throws std::runtime_error If the spacecraft is not coasting (see @ref isCoasting)
+     */
+    void coast(double duration);
+
     /**
      * @brief Set thrust up to specific level for main engine
      * @param targetThrustInPercentage clamped to [0, 1] where 1 is 100% of max thrust
@@ -321,6 +407,24 @@ public:
      */
     void setConsoleText(const std::string &txt);
 
+    /**
+     * @brief Sets the terrain used for ground contact and altitude
+     * @param terrain Surface height model. nullptr restores the spherical surface.
+     */
+    void setTerrainModel(std::shared_ptr<const ITerrainModel> terrain);
+
+    /**
+     * @brief Sets the physics model (gravity field) acting on the spacecraft
+     * @param model Physics model, may be shared with other spacecraft
+     */
+    void setPhysicsModel(std::shared_ptr<IPhysicsModel> model);
+
+    /**
+     * @brief Adds a time dependent perturbation (e.g. Earth and Sun tides)
+     * @param perturbation Perturbation, may be shared with other spacecraft
+     */
+    void addPerturbation(std::shared_ptr<const IPerturbation> perturbation);
+
     /**
      * @brief compute optimization
      * @return vector with optimized thrust controls
@@ -472,6 +576,26 @@ public:
      */
     Vector3 getPosition() const;
 
+    /**
+     * @brief Return position relative to the floating origin
+     *
+     * Small magnitudes, suitable for single precision computations.
+     * @return Local position [m]
+     */
+    Vector3 getLocalPosition() const;
+
+    /**
+     * @brief Return the floating origin of the local frame
+     * @return Origin in Moon-centered coordinates [m]
+     */
+    const Vector3& getOrigin() const;
+
+    /**
+     * @brief Return height above the terrain below the spacecraft
+     * @return Altitude above ground [m]. Zero or negative means ground contact.
+     */
+    double getAltitude() const;
+
     /**
      * @brief Return current velocity of spacecraft
     //  * @return Current velocity [m/s]
@@ -490,6 +614,15 @@ public:
      */
     Vector3 getAngularVelocity() const;
 
+    /**
+     * @brief Return specific force acting on the spacecraft
+     *
+     * Non-gravitational acceleration as measured by an accelerometer: the
+     * thrust while operational, the ground reaction after touchdown.
+     * @return Specific force in the body frame [m/s²]
+     */
+    Vector3 getSpecificForce() const;
+
     /**
      * @brief Return current total mass
      * @return total mass
@@ -534,6 +667,57 @@ public:
      * @return Current spacecraft state
      */
     SpacecraftState getSpacecraftState() const;
+
+    /**
+     * @brief Return simulation time accumulated by updateStep
+     * @return Simulation time [s]
+     */
+    double getTime() const;
+
+    /**
+     * @brief Return whether the spacecraft is on a Kepler orbit
+     *
+     * True if operational, all engines are commanded to zero and below
+     * @ref IDLE_THRUST, and the gravity field is a point mass without
+     * perturbations.
+     */
+    bool isCoasting() const;
+
+    /**
+     * @brief Return time until the coast orbit reaches an altitude
+     *
+     * The altitude refers to the mean lunar radius; terrain is not taken into
+     * account.
+     *
+     * @param altitude Altitude above the mean lunar radius [m]
+     * @return Time of the first crossing [s], or infinity if the orbit never
+     *         reaches it or the spacecraft is not coasting
+     */
+    double timeToAltitude(double altitude) const;
+
+    // -------------------------------------------------------------------------
+    // Checkpoint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Appends the dynamic spacecraft and propulsion state to a checkpoint
+     * @param writer Checkpoint writer
+     */
+    void writeCheckpoint(CheckpointWriter &writer) const;
+
+    /**
+     * @brief Reads the spacecraft section of a checkpoint without applying it
+     * @param reader Checkpoint reader positioned at the spacecraft section
+     * @param out Receives the decoded section
+     * @throws std::runtime_error If the engine or tank layout does not match
+     */
+    void readCheckpoint(CheckpointReader &reader, SpacecraftCheckpointSection &out) const;
+
+    /**
+     * @brief Restores the dynamic spacecraft and propulsion state
+     * @param section Section decoded by readCheckpoint()
+     */
+    void restoreCheckpoint(const SpacecraftCheckpointSection &section);
 };
 
 #endif
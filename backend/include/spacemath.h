@@ -5,7 +5,7 @@
 
 
 /**
- * @class spacemath
+ * @class spacemathT
  * @brief Utility class for space-related physics calculations.
  *
  * This class provides static methods to compute common physical quantities
@@ -13,19 +13,24 @@
  * or other physics-based calculations.
  *
  * All functions are static and can be called without instantiating the class.
+ * They are defined in spacemath.cpp and explicitly instantiated for float and
+ * double.
+ *
+ * @tparam T Scalar type (float or double)
  */
-class spacemath
+template<typename T>
+class spacemathT
 {
 public:
     /**
      * @brief Constructor (trivial, no data members)
      */
-    spacemath() = default;
+    spacemathT() = default;
 
     /**
      * @brief Destructor (trivial)
      */
-    ~spacemath() = default;
+    ~spacemathT() = default;
 
     /**
      * @brief Computes kinetic energy.
@@ -37,7 +42,7 @@ public:
      * @param velocity  ///< [m/s] Velocity of the object 
      * @return          ///< [J] Kinetic energy 
      */
-    static double kineticEnergy(double mass, double velocity);
+    static T kineticEnergy(T mass, T velocity);
 
     /**
      * @brief Calculates acceleration based on thrust
@@ -46,7 +51,7 @@ public:
      * 
      * a = F{thrust} / m{total}
      */
-    static double accelerationBasedOnThrust(double thrust, double mass);
+    static T accelerationBasedOnThrust(T thrust, T mass);
 
     /**
      * @brief Calculates acceleration based on thrust, mass and specific impulse
@@ -57,7 +62,7 @@ public:
      * @return                  ///< [m/s²] Acceleration of Spacecraft due to thrust, mass and thrust 
      * 
      */
-    static Vector3 accelerationComplex(double currentThrust, double totalMass, Vector3 directionOfThrust, Vector3 gravityConstant);
+    static Vector3T<T> accelerationComplex(T currentThrust, T totalMass, Vector3T<T> directionOfThrust, Vector3T<T> gravityConstant);
 
     /**
      * @brief Calcualtes acceleration in relation with thrust direction
@@ -65,7 +70,7 @@ public:
      * @param thrustDirection   ///< [-] Vector with direction of thrust. Static coordinate system is spacecraft.
      * @return                  ///< [m/s²] Return acceleration vector
      */
-    static Vector3 calcAccelerationVector(double currentThrust, Vector3 thrustDirection);
+    static Vector3T<T> calcAccelerationVector(T currentThrust, Vector3T<T> thrustDirection);
 
     /**
      * @brief Calculates Mass flow based on thrust
@@ -78,9 +83,15 @@ public:
      * 
      * \dot(m) = F / (I_{Sp} \cdot g_0)
      */
-    static double calcMassFlowBasedOnThrust(double currenThrust, double Isp, double earthGravity);
+    static T calcMassFlowBasedOnThrust(T currenThrust, T Isp, T earthGravity);
 
     
 };
 
+extern template class spacemathT<double>;
+extern template class spacemathT<float>;
+
+using spacemath  = spacemathT<double>;  ///< Default precision used by the simulation
+using spacemathf = spacemathT<float>;   ///< Single precision for throughput paths
+
 #endif
@@ -0,0 +1,87 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class SpscRing
+ * @brief Bounded lock-free queue for one producer and one consumer thread.
+ *
+ * The producer only writes @c tail_, the consumer only writes @c head_. Each
+ * side publishes with a release store and reads the other side's index with an
+ * acquire load, so a slot is handed over complete. No side ever waits; a full
+ * ring rejects the push and an empty ring rejects the pop.
+ *
+ * Each side caches the other's index and reloads it only when the ring looks
+ * full or empty. The two indices live on separate cache lines, so the threads
+ * do not share a written line in steady state.
+ *
+ * @tparam T Element type; moved in and out of preallocated slots
+ * @tparam Capacity Number of slots, a power of two
+ */
+template<typename T, std::size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRing: capacity must be a power of two");
+
+public:
+    /**
+     * @brief Appends an element; producer thread only
+     * @param value Element
+     * @return False if the ring is full, the element is then not consumed
+     */
+    bool push(T value)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ == Capacity)
+        {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ == Capacity)
+                return false;
+        }
+
+        slots_[tail & MASK] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element; consumer thread only
+     * @param out Receives the element
+     * @return False if the ring is empty
+     */
+    bool pop(T& out)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_)
+        {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_)
+                return false;
+        }
+
+        out = std::move(slots_[head & MASK]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @return Number of slots
+    static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::array<T, Capacity> slots_{};
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};  ///< Next slot to read, written by the consumer
+    std::size_t tailCache_ = 0;                             ///< Consumer's copy of tail_
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};  ///< Next slot to write, written by the producer
+    std::size_t headCache_ = 0;                             ///< Producer's copy of head_
+};
+
+#endif // SPSCRING_H
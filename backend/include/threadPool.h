@@ -0,0 +1,89 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads for fork/join style loops.
+ *
+ * The pool is built for the simulation step: many independent, similar
+ * sized work items that must all finish before the step returns.
+ * @ref parallelFor hands out indices through an atomic counter, the calling
+ * thread takes part in the work, and the call blocks until every index was
+ * processed. Worker threads sleep between calls.
+ *
+ * parallelFor is not reentrant and must only be called from one thread at a
+ * time.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threadCount Number of worker threads in addition to the caller.
+     *                    0 selects hardware_concurrency() - 1.
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+
+    /**
+     * @brief Stops and joins all worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Calls @p fn(i) for every i in [0, count) and waits for completion.
+     *
+     * If any call throws, the remaining indices are still processed and the
+     * first exception is rethrown on the calling thread.
+     *
+     * @param count Number of work items
+     * @param fn Work function, must be safe to call concurrently for distinct indices
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+    /// @return Number of worker threads (excluding the caller)
+    std::size_t threadCount() const;
+
+private:
+    /**
+     * @brief Worker thread main loop.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Processes indices of the current job until none are left.
+     */
+    void runJob();
+
+    //***********************************************************
+    //*************            Members           ****************
+    //***********************************************************
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    std::condition_variable jobDone_;
+
+    const std::function<void(std::size_t)>* job_ = nullptr; ///< Current work function
+    std::size_t jobCount_ = 0;                              ///< Number of items of the current job
+    std::atomic<std::size_t> nextIndex_{0};                 ///< Next unclaimed index
+    std::size_t generation_ = 0;                            ///< Incremented for every job
+    std::size_t activeWorkers_ = 0;                         ///< Workers still inside the current job
+    bool stop_ = false;
+
+    std::exception_ptr error_;                              ///< First exception of the current job
+};
+
+#endif // THREADPOOL_H
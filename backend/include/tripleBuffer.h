@@ -0,0 +1,63 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Lock-free latest-value slot between one writer and one reader thread.
+ *
+ * Three buffers rotate between the roles back (being written), middle (last
+ * published) and front (being read). @ref publish swaps back and middle, and
+ * @ref update swaps middle and front. Both are a single atomic exchange.
+ * Neither side ever waits. The reader always gets the newest complete value
+ * and skips intermediate ones. The writer overwrites unread values instead of
+ * queueing them.
+ *
+ * The buffers are reused, so values with heap members (vectors, strings) stop
+ * allocating once their capacity has grown.
+ *
+ * @tparam T Value type
+ */
+template<typename T>
+class TripleBuffer
+{
+public:
+    /// @return Buffer to fill before the next @ref publish; writer thread only
+    T& back() { return buffers_[back_]; }
+
+    /// @brief Makes the back buffer the latest value; writer thread only
+    void publish()
+    {
+        back_ = middle_.exchange(static_cast<std::uint8_t>(back_ | FRESH), std::memory_order_acq_rel) & INDEX;
+    }
+
+    /**
+     * @brief Takes the latest value if one was published since the last call; reader thread only
+     * @return True if @ref front changed
+     */
+    bool update()
+    {
+        if (!(middle_.load(std::memory_order_relaxed) & FRESH))
+            return false;
+
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    /// @return Latest value taken by @ref update; reader thread only
+    const T& front() const { return buffers_[front_]; }
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3;      ///< Buffer index bits of middle_
+    static constexpr std::uint8_t FRESH = 0x4;      ///< Set while middle_ holds an unread value
+
+    std::array<T, 3> buffers_{};
+    std::uint8_t back_ = 0;                         ///< Owned by the writer
+    std::uint8_t front_ = 2;                        ///< Owned by the reader
+    alignas(64) std::atomic<std::uint8_t> middle_{1};
+};
+
+#endif // TRIPLEBUFFER_H
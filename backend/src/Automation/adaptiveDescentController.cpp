@@ -3,11 +3,18 @@
 #include <iostream>
 
 #include "Controller/iController.h"
+#include "dual.h"
 
 // ------------------------------------------------
 // Public:
 // ------------------------------------------------
 double AdaptiveDescentController::setAutoThrustInNewton(IController *useController, const double &T_max, const double &vel, const double &h, const double &dt, const double &m, const double &g) const
+{
+    return computeThrust(useController, gains_, T_max, vel, h, dt, m, g);
+}
+
+template<typename T>
+T AdaptiveDescentController::computeThrust(const IControllerT<T> *useController, const DescentGainsT<T> &gains, const T &T_max, const T &vel, const T &h, const T &dt, const T &m, const T &g) const
 {
 
     if (!useController)
@@ -16,29 +23,29 @@ double AdaptiveDescentController::setAutoThrustInNewton(IController *useControll
         return calcHoverThrust(m, g);
     }
 
-    double T_cmd = 0.0;
+    T T_cmd = T(0.0);
 
-    double a_max = calcMaxAcc(T_max, m, g);
+    T a_max = calcMaxAcc(T_max, m, g);
 
-    double d_brake = calcBrakingDistance(vel, a_max);
+    T d_brake = calcBrakingDistance(vel, a_max);
 
-    double R_brake = calcBrakeRatio(h,d_brake);
+    T R_brake = calcBrakeRatio(h,d_brake);
 
-    double k_r = interpolate_k_r(R_brake);
+    T k_r = interpolate_k_r(R_brake, gains);
 
-    double K_p = interpolate_Kp(R_brake);
+    T K_p = interpolate_Kp(R_brake, gains);
 
-    double K_d = interpolate_Kd(R_brake);
+    T K_d = interpolate_Kd(R_brake, gains);
 
-    double v_target = calcTargetVelocity(a_max, h, k_r, vel, dt);
+    T v_target = calcTargetVelocity(a_max, h, k_r, vel, dt);
 
-    double T_hover = calcHoverThrust(m, g);
+    T T_hover = calcHoverThrust(m, g);
 
-    double a_cmd_ctrl = useController->control(v_target, vel, K_p, K_d, dt);
+    T a_cmd_ctrl = useController->control(v_target, vel, K_p, K_d, dt);
 
-    double T_cmd_ctrl = calcThrustCommand(T_hover, a_cmd_ctrl, m);
+    T T_cmd_ctrl = calcThrustCommand(T_hover, a_cmd_ctrl, m);
 
-    double T_cmd_Saturated = calcSaturation(T_cmd_ctrl, T_max);
+    T T_cmd_Saturated = calcSaturation(T_cmd_ctrl, T_max);
 
     T_cmd = T_cmd_Saturated;
 
@@ -64,74 +71,103 @@ std::string AdaptiveDescentController::getDescentMode() const
     }
 }
 
+AutopilotCheckpoint AdaptiveDescentController::captureCheckpoint() const
+{
+    AutopilotCheckpoint checkpoint;
+    checkpoint.descentMode = descentMode_;
+    return checkpoint;
+}
+
+void AdaptiveDescentController::restoreCheckpoint(const AutopilotCheckpoint &checkpoint)
+{
+    descentMode_ = checkpoint.descentMode;
+}
+
+const DescentGains& AdaptiveDescentController::getGains() const
+{
+    return gains_;
+}
+
+void AdaptiveDescentController::setGains(const DescentGains &gains)
+{
+    gains_ = gains;
+}
+
 // ------------------------------------------------
 // Private:
 // ------------------------------------------------
 
-double AdaptiveDescentController::calcMaxAcc(const double &T_max, const double &m, const double &g) const
+template<typename T>
+T AdaptiveDescentController::calcMaxAcc(const T &T_max, const T &m, const T &g) const
 {
     const double epsilon = 1e-6;
 
     if (m <= 0.0)
     {
-        return 0.0; // Physical illogical
+        return T(0.0); // Physical illogical
     }
 
-    double a_max = T_max / m - g;
+    T a_max = T_max / m - g;
 
     // In case of a_max is zero or beneath zero
     if (a_max < epsilon)
     {
-        a_max = epsilon;
+        a_max = T(epsilon);
     }
 
     return a_max;
 }
 
-double AdaptiveDescentController::calcBrakingDistance(const double &vel, const double &a_max) const
+template<typename T>
+T AdaptiveDescentController::calcBrakingDistance(const T &vel, const T &a_max) const
 {
-    if (a_max <= 0)
+    if (a_max <= 0.0)
     {
-        return 0.0;
+        return T(0.0);
     }
 
-    return (vel *vel) / (2* a_max); // d_brake
+    return (vel *vel) / (2.0 * a_max); // d_brake
 }
 
-double AdaptiveDescentController::calcBrakeRatio(const double& h, const double &d_brake) const
+template<typename T>
+T AdaptiveDescentController::calcBrakeRatio(const T& h, const T &d_brake) const
 {
     // Epsilon preserves division by zero
     const double epsilon = 1e-6;
 
-    double R_brake = 0.0;
+    T R_brake = T(0.0);
 
-    if (h > 0)
+    if (h > 0.0)
     {
         R_brake = h / (d_brake + epsilon);
     }
     else
     {
-        R_brake = 0.0;
+        R_brake = T(0.0);
     }
 
     return R_brake; // R_brake
 }
 
-double AdaptiveDescentController::calcTargetVelocity(const double &a_max, const double &h, const double k_r, const double &vel, const double &dt) const
+template<typename T>
+T AdaptiveDescentController::calcTargetVelocity(const T &a_max, const T &h, const T k_r, const T &/*vel*/, const T &/*dt*/) const
 {
-    double term = 2 * k_r * a_max * h;
+    using std::sqrt;
 
-    if (term > 0)
+    T term = 2.0 * k_r * a_max * h;
+
+    if (term > 0.0)
     {
         return -sqrt(term);
     }
     else
     {
-        return 0.0;
+        return T(0.0);
     }
 }
 
-double AdaptiveDescentController::calcHoverThrust(const double &m, const double &g) const
+template<typename T>
+T AdaptiveDescentController::calcHoverThrust(const T &m, const T &g) const
 {
     return m * g;
 }
@@ -141,23 +177,25 @@ double AdaptiveDescentController::calcHoverThrottle(const double &m, const doubl
     return (m * g) / T_max;
 }
 
-double AdaptiveDescentController::calcThrustCommand(const double &T_hover, const double &a_controlled, const double &m) const
+template<typename T>
+T AdaptiveDescentController::calcThrustCommand(const T &T_hover, const T &a_controlled, const T &m) const
 {
-    double T_cmd = T_hover + (a_controlled * m);
+    T T_cmd = T_hover + (a_controlled * m);
 
-    if (T_cmd > 0)
+    if (T_cmd > 0.0)
     {
         return T_cmd;
     }
     else
     {
-        return 0.0;
+        return T(0.0);
     }
 }
 
-double AdaptiveDescentController::calcSaturation(const double &T_cmd, const double &T_max) const
+template<typename T>
+T AdaptiveDescentController::calcSaturation(const T &T_cmd, const T &T_max) const
 {
-    double T_cmdPreSaturation = (T_cmd > 0.0) ? T_cmd : 0.0;
+    T T_cmdPreSaturation = (T_cmd > 0.0) ? T_cmd : T(0.0);
 
     return (T_cmdPreSaturation < T_max) ? T_cmdPreSaturation : T_max;
 }
@@ -167,23 +205,24 @@ double AdaptiveDescentController::calcNormalizedThrust(const double &T_cmd, cons
     return T_cmd / T_max;
 }
 
-double AdaptiveDescentController::interpolate_k_r(double R_brake) const
+template<typename T>
+T AdaptiveDescentController::interpolate_k_r(const T &R_brake, const DescentGainsT<T> &gains) const
 {
-    // Define typical k_r per mode
-    constexpr double kA = 0.25; // Energy Dissipation
-    constexpr double kB = 0.15; // Controlled Descent
-    constexpr double kC = 0.05; // Terminal Approach
-    constexpr double kD = 2.5; // Critical Braking
+    // Typical k_r per mode
+    const T &kA = gains.k_r_A; // Energy Dissipation
+    const T &kB = gains.k_r_B; // Controlled Descent
+    const T &kC = gains.k_r_C; // Terminal Approach
+    const T &kD = gains.k_r_D; // Critical Braking
 
     if (R_brake >= 3.0) return kA;
     if (R_brake >= 1.5) // blend B–A
     {
-        double alpha = (R_brake - 1.5) / (3.0 - 1.5); // 0..1
+        T alpha = (R_brake - 1.5) / (3.0 - 1.5); // 0..1
         return kB * (1.0 - alpha) + kA * alpha;
     }
     if (R_brake >= 1.0) // blend C–B
     {
-        double alpha = (R_brake - 1.0) / (1.5 - 1.0); // 0..1
+        T alpha = (R_brake - 1.0) / (1.5 - 1.0); // 0..1
         return kC * (1.0 - alpha) + kB * alpha;
     }
     // R_brake < 1 → Critical
@@ -197,23 +236,22 @@ double AdaptiveDescentController::interpolate_k_r(double R_brake) const
  * at the start of descent while remaining moderate during terminal braking.
  *
  * @param R_brake The brake ratio (h / d_brake)
+ * @param gains Tuning constants
  * @return The proportional gain Kp
  */
-double AdaptiveDescentController::interpolate_Kp(double R_brake) const
+template<typename T>
+T AdaptiveDescentController::interpolate_Kp(const T &R_brake, const DescentGainsT<T> &gains) const
 {
-    constexpr double Kp_min = 0.8;   // minimal gain (far from ground)
-    constexpr double Kp_max = 50.0;  // maximal gain (start of descent)
     constexpr double R_ref  = 3.0;   // reference ratio where min gain applies
 
     if (R_brake <= R_ref)
-        return Kp_min;
+        return gains.Kp_min;
 
     // Linear scaling beyond R_ref
-    double scale = 0.1; // adjust to tune aggressiveness
-    double Kp = Kp_min + (R_brake - R_ref) * scale;
+    T Kp = gains.Kp_min + (R_brake - R_ref) * gains.Kp_scale;
 
     // Clamp to Kp_max
-    if (Kp > Kp_max) Kp = Kp_max;
+    if (Kp > gains.Kp_max) Kp = gains.Kp_max;
 
     return Kp;
 }
@@ -225,26 +263,26 @@ double AdaptiveDescentController::interpolate_Kp(double R_brake) const
  * at high altitude while staying small during terminal descent.
  *
  * @param R_brake The brake ratio (h / d_brake)
+ * @param gains Tuning constants
  * @return The derivative gain Kd
  */
-double AdaptiveDescentController::interpolate_Kd(double R_brake) const
+template<typename T>
+T AdaptiveDescentController::interpolate_Kd(const T &R_brake, const DescentGainsT<T> &gains) const
 {
-    constexpr double Kd_min = 0.05;   // minimal gain (terminal phase)
-    constexpr double Kd_max = 10.0;   // maximal gain (start of descent)
     constexpr double R_ref  = 3.0;    // reference ratio where min gain applies
 
     if (R_brake <= R_ref)
-        return Kd_min;
+        return gains.Kd_min;
 
-    double scale = 0.05; // adjust to tune damping
-    double Kd = Kd_min + (R_brake - R_ref) * scale;
+    T Kd = gains.Kd_min + (R_brake - R_ref) * gains.Kd_scale;
 
-    if (Kd > Kd_max) Kd = Kd_max;
+    if (Kd > gains.Kd_max) Kd = gains.Kd_max;
 
     return Kd;
 }
 
-DescentMode AdaptiveDescentController::determineMode(double R_brake) const
+template<typename T>
+DescentMode AdaptiveDescentController::determineMode(const T &R_brake) const
 {
     DescentMode descentmode_;
     if (R_brake > 3.0) descentmode_ = DescentMode::MODE_A;
@@ -255,4 +293,6 @@ DescentMode AdaptiveDescentController::determineMode(double R_brake) const
     return descentmode_;
 }
 
-
+// explicit instantiations
+template double AdaptiveDescentController::computeThrust<double>(const IControllerT<double>*, const DescentGainsT<double>&, const double&, const double&, const double&, const double&, const double&, const double&) const;
+template SensitivityScalar AdaptiveDescentController::computeThrust<SensitivityScalar>(const IControllerT<SensitivityScalar>*, const DescentGainsT<SensitivityScalar>&, const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&) const;
@@ -0,0 +1,108 @@
+#include "Checkpoint/snapshotRingBuffer.h"
+#include "simcontrol.h"
+
+#include <algorithm>
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+SnapshotRingBuffer::SnapshotRingBuffer(std::size_t capacity, double interval)
+    : slots_(std::max<std::size_t>(capacity, 1)),
+    interval_(interval)
+{
+}
+
+void SnapshotRingBuffer::clear()
+{
+    head_ = 0;
+    count_ = 0;
+    nextSnapshotTime_ = 0.0;
+}
+
+bool SnapshotRingBuffer::record(const simcontrol& sim)
+{
+    const double t = sim.getSimulationTime();
+
+    if (count_ > 0 && t < nextSnapshotTime_)
+        return false;
+
+    // Append at the end; overwrite the oldest slot when full
+    std::size_t index;
+    if (count_ < slots_.size())
+    {
+        index = slotIndex(count_);
+        ++count_;
+    }
+    else
+    {
+        index = head_;
+        head_ = (head_ + 1) % slots_.size();
+    }
+
+    Slot& slot = slots_[index];
+    slot.time = t;
+    sim.checkpoint(slot.blob);
+
+    if (!reserved_)
+    {
+        for (Slot& s : slots_)
+            s.blob.reserve(slot.blob.size());
+        reserved_ = true;
+    }
+
+    nextSnapshotTime_ = t + interval_;
+    return true;
+}
+
+bool SnapshotRingBuffer::rewind(simcontrol& sim, double seconds)
+{
+    if (count_ == 0)
+        return false;
+
+    const double target = sim.getSimulationTime() - std::max(seconds, 0.0);
+
+    // Newest snapshot not later than target; fall back to the oldest
+    std::size_t keep = 0;
+    for (std::size_t i = count_; i-- > 0;)
+    {
+        if (slots_[slotIndex(i)].time <= target)
+        {
+            keep = i;
+            break;
+        }
+    }
+
+    const Slot& slot = slots_[slotIndex(keep)];
+    sim.restore(slot.blob);
+
+    // Discard the abandoned future
+    count_ = keep + 1;
+    nextSnapshotTime_ = slot.time + interval_;
+    return true;
+}
+
+std::size_t SnapshotRingBuffer::size() const
+{
+    return count_;
+}
+
+std::size_t SnapshotRingBuffer::capacity() const
+{
+    return slots_.size();
+}
+
+double SnapshotRingBuffer::span() const
+{
+    if (count_ == 0)
+        return 0.0;
+
+    return slots_[slotIndex(count_ - 1)].time - slots_[head_].time;
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+std::size_t SnapshotRingBuffer::slotIndex(std::size_t i) const
+{
+    return (head_ + i) % slots_.size();
+}
@@ -22,6 +22,27 @@ void InputArbiter::receiveAutoControlCommand(const ControlCommand &autoCmd)
     autoCmd_ = autoCmd;
 }
 
+bool InputArbiter::isAutomationActive() const
+{
+    return automationActive;
+}
+
+ArbiterCheckpoint InputArbiter::captureCheckpoint() const
+{
+    ArbiterCheckpoint checkpoint;
+    checkpoint.usrCmd           = usrCmd_;
+    checkpoint.autoCmd          = autoCmd_;
+    checkpoint.automationActive = automationActive;
+    return checkpoint;
+}
+
+void InputArbiter::restoreCheckpoint(const ArbiterCheckpoint &checkpoint)
+{
+    usrCmd_             = checkpoint.usrCmd;
+    autoCmd_            = checkpoint.autoCmd;
+    automationActive    = checkpoint.automationActive;
+}
+
 void InputArbiter::setAutomationActiveFlag(bool on)
 {
     automationActive = on;
@@ -0,0 +1,65 @@
+#include "Control/rateSchedule.h"
+
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+RateSchedule::RateSchedule(const TaskRates& rates) : rates_(rates)
+{
+    if (!(rates.physics > 0.0))
+    {
+        throw std::runtime_error("RateSchedule: physics rate must be positive");
+    }
+    tickPeriod_ = 1.0 / rates.physics;
+
+    const std::array<double, TASKS> taskRates{rates.autopilot, rates.propulsion, rates.physics, rates.sensors};
+
+    std::uint64_t major = 1;
+    for (std::size_t t = 0; t < TASKS; ++t)
+    {
+        const double ratio = rates.physics / taskRates[t];
+        const double divisor = std::round(ratio);
+
+        if (!(taskRates[t] > 0.0) || divisor < 1.0 || std::abs(ratio - divisor) > 1e-9 * divisor)
+        {
+            throw std::runtime_error("RateSchedule: rate " + std::to_string(taskRates[t]) +
+                                     " Hz does not divide the physics rate " + std::to_string(rates.physics) + " Hz");
+        }
+
+        divisor_[t] = static_cast<std::uint64_t>(divisor);
+        major = std::lcm(major, divisor_[t]);
+    }
+
+    frame_.assign(major, 0);
+    for (std::size_t tick = 0; tick < major; ++tick)
+    {
+        for (std::size_t t = 0; t < TASKS; ++t)
+        {
+            if (tick % divisor_[t] == 0)
+            {
+                frame_[tick] |= static_cast<std::uint8_t>(1u << t);
+            }
+        }
+    }
+}
+
+double RateSchedule::tickPeriod() const
+{
+    return tickPeriod_;
+}
+
+double RateSchedule::period(SimTask task) const
+{
+    return divisor_[static_cast<std::size_t>(task)] * tickPeriod_;
+}
+
+std::size_t RateSchedule::majorFrame() const
+{
+    return frame_.size();
+}
+
+const TaskRates& RateSchedule::rates() const
+{
+    return rates_;
+}
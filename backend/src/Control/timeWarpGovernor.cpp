@@ -0,0 +1,56 @@
+#include "Control/timeWarpGovernor.h"
+
+#include <algorithm>
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+TimeWarpGovernor::TimeWarpGovernor(const TimeWarpLimits& limits) : limits_(limits)
+{
+}
+
+double TimeWarpGovernor::limit(double requested, double altitude, double GLoad, bool thrustActive) const
+{
+    double warp = requested;
+
+    if (thrustActive)
+    {
+        warp = std::min(warp, limits_.maxWarpUnderThrust);
+    }
+
+    if (GLoad > limits_.maxGLoad)
+    {
+        warp = 1.0;
+    }
+
+    // Warp shrinks linearly with altitude, so time to impact on screen stays roughly constant
+    if (limits_.altitudePerWarp > 0.0)
+    {
+        warp = std::min(warp, altitude / limits_.altitudePerWarp);
+    }
+
+    return snapToLevel(warp);
+}
+
+double TimeWarpGovernor::snapToLevel(double warp)
+{
+    double level = LEVELS.front();
+
+    for (const double candidate : LEVELS)
+    {
+        if (candidate <= warp)
+            level = candidate;
+    }
+
+    return level;
+}
+
+const TimeWarpLimits& TimeWarpGovernor::limits() const
+{
+    return limits_;
+}
+
+void TimeWarpGovernor::setLimits(const TimeWarpLimits& limits)
+{
+    limits_ = limits;
+}
@@ -1,37 +1,59 @@
 #include "Controller/pd_controller.h"
+#include "dual.h"
 #include <iostream>
 
 // ------------------------------------------------
 // Public:
 // ------------------------------------------------
-double PD_Controller::control(const double &targetValue, const double &measuredValue, const double &K_p, const double &K_d, const double &dt) const
+template<typename T>
+T PD_ControllerT<T>::control(const T &targetValue, const T &measuredValue, const T &K_p, const T &K_d, const T &dt) const
 {
-    double error        = calcError(targetValue, measuredValue);
+    T error        = calcError(targetValue, measuredValue);
 
-    double differential = calcDifferential(error, error_old_, dt);
+    T differential = calcDifferential(error, error_old_, dt);
 
-    double P_term = error * K_p;
+    T P_term = error * K_p;
 
-    double D_term = differential * K_d;
+    T D_term = differential * K_d;
 
-    double controlValue = P_term + D_term;
+    T controlValue = P_term + D_term;
 
     return controlValue;
 }
 
+template<typename T>
+ControllerCheckpoint PD_ControllerT<T>::captureCheckpoint() const
+{
+    ControllerCheckpoint checkpoint;
+    checkpoint.errorOld = valueOf(error_old_);
+    return checkpoint;
+}
+
+template<typename T>
+void PD_ControllerT<T>::restoreCheckpoint(const ControllerCheckpoint &checkpoint)
+{
+    error_old_ = T(checkpoint.errorOld);
+}
+
 // ------------------------------------------------
 // Private:
 // ------------------------------------------------
-double PD_Controller::calcError(const double &targetValue, const double &measureValue) const
+template<typename T>
+T PD_ControllerT<T>::calcError(const T &targetValue, const T &measureValue) const
 {
     return targetValue - measureValue;
 }
 
-double PD_Controller::calcDifferential(const double &error, const double &error_old, const double &dt) const
+template<typename T>
+T PD_ControllerT<T>::calcDifferential(const T &error, const T &error_old, const T &dt) const
 {
-    double differential = (error - error_old) / dt;
+    T differential = (error - error_old) / dt;
 
     error_old_ = error;
 
     return differential;
 }
+
+// explicit instantiations
+template class PD_ControllerT<double>;
+template class PD_ControllerT<SensitivityScalar>;
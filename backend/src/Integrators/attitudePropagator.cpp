@@ -0,0 +1,201 @@
+#include "Integrators/attitudePropagator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    constexpr double PI    = 3.141592653589793;
+    constexpr double SQRT3 = 1.7320508075688772;
+
+    /// |ω × H| relative to |ω||H| below which the spin is treated as steady
+    constexpr double STEADY_SPIN_TOLERANCE = 1e-12;
+
+    /**
+     * @brief Torque-free rotation over equal steps.
+     *
+     * The rate is advanced with classical Runge-Kutta and interpolated with a
+     * cubic Hermite polynomial at the two Gauss points of the step. The
+     * orientation is rotated by the fourth-order Magnus exponent built from
+     * them, so a fast spin with a slowly moving axis costs no extra steps.
+     *
+     * @param steps Number of equal steps, bounded by the caller
+     */
+    void integrateTorqueFree(const AttitudePropagator& propagator, Quaternion& IB_orientation, Vector3& B_omega, double duration, int steps)
+    {
+        const Vector3 noTorque = {0.0, 0.0, 0.0};
+        const double h = duration / steps;
+
+        // Gauss points of the unit step, 1/2 ∓ √3/6
+        const double gauss[2] = {0.5 - SQRT3 / 6.0, 0.5 + SQRT3 / 6.0};
+
+        Vector3 omega = B_omega;
+        Vector3 rate  = propagator.angularAcceleration(omega, noTorque);
+
+        for (int i = 0; i < steps; ++i)
+        {
+            const Vector3 k1 = rate;
+            const Vector3 k2 = propagator.angularAcceleration(omega + k1 * (0.5 * h), noTorque);
+            const Vector3 k3 = propagator.angularAcceleration(omega + k2 * (0.5 * h), noTorque);
+            const Vector3 k4 = propagator.angularAcceleration(omega + k3 * h, noTorque);
+
+            const Vector3 nextOmega = omega + (k1 + k2 * 2.0 + k3 * 2.0 + k4) * (h / 6.0);
+            const Vector3 nextRate  = propagator.angularAcceleration(nextOmega, noTorque);
+
+            Vector3 atGauss[2];
+            for (int j = 0; j < 2; ++j)
+            {
+                const double t = gauss[j];
+                const double t2 = t * t;
+                const double t3 = t2 * t;
+                atGauss[j] = omega * (2.0 * t3 - 3.0 * t2 + 1.0) + rate * ((t3 - 2.0 * t2 + t) * h)
+                           + nextOmega * (-2.0 * t3 + 3.0 * t2) + nextRate * ((t3 - t2) * h);
+            }
+
+            const Vector3 rotation = (atGauss[0] + atGauss[1]) * (0.5 * h)
+                                   + atGauss[0].cross(atGauss[1]) * (SQRT3 / 12.0 * h * h);
+            IB_orientation = IB_orientation * Quaternion::exp(rotation);
+            IB_orientation.normalize();
+
+            omega = nextOmega;
+            rate  = nextRate;
+        }
+
+        B_omega = omega;
+    }
+
+    /// Steps for a span, proportional to its share of the period and at most one period's worth
+    int stepsFor(double span, double period)
+    {
+        const double share = std::isfinite(period) ? std::min(1.0, span / period) : 1.0;
+        return std::max(1, static_cast<int>(std::ceil(AttitudePropagator::COAST_STEPS_PER_PERIOD * share)));
+    }
+}
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+AttitudePropagator::AttitudePropagator(const Vector3& B_inertia)
+    : inertia_(B_inertia)
+{
+    if (!(B_inertia.x > 0.0) || !(B_inertia.y > 0.0) || !(B_inertia.z > 0.0))
+    {
+        throw std::runtime_error("AttitudePropagator: moments of inertia must be positive");
+    }
+
+    inverseInertia_ = {1.0 / B_inertia.x, 1.0 / B_inertia.y, 1.0 / B_inertia.z};
+}
+
+Vector3 AttitudePropagator::angularAcceleration(const Vector3& B_omega, const Vector3& B_torque) const
+{
+    // Angular momentum in the body frame, H = I * omega
+    const Vector3 H = {inertia_.x * B_omega.x, inertia_.y * B_omega.y, inertia_.z * B_omega.z};
+
+    // Gyroscopic coupling of the rotating body frame
+    const Vector3 net = B_torque - B_omega.cross(H);
+
+    return {net.x * inverseInertia_.x, net.y * inverseInertia_.y, net.z * inverseInertia_.z};
+}
+
+void AttitudePropagator::propagate(Quaternion& IB_orientation, Vector3& B_omega, const Vector3& B_torque, double dt) const
+{
+    B_omega        += angularAcceleration(B_omega, B_torque) * dt;
+    IB_orientation  = IB_orientation.integrated(B_omega, dt);
+}
+
+void AttitudePropagator::coast(Quaternion& IB_orientation, Vector3& B_omega, double duration) const
+{
+    if (B_omega.norm() == 0.0 || duration <= 0.0)
+    {
+        return;
+    }
+
+    // Steady spin about a principal axis, or a spherical body: the rate is constant
+    const Vector3 B_H = {inertia_.x * B_omega.x, inertia_.y * B_omega.y, inertia_.z * B_omega.z};
+    if (B_omega.cross(B_H).norm() <= STEADY_SPIN_TOLERANCE * B_omega.norm() * B_H.norm())
+    {
+        IB_orientation = IB_orientation.integrated(B_omega, duration);
+        return;
+    }
+
+    const double period = nutationPeriod(B_omega);
+    if (!(period < duration))
+    {
+        integrateTorqueFree(*this, IB_orientation, B_omega, duration, stepsFor(duration, period));
+        return;
+    }
+
+    // One period returns the rate and turns the body about the fixed angular momentum
+    Quaternion afterPeriod = IB_orientation;
+    Vector3 omegaAfterPeriod = B_omega;
+    integrateTorqueFree(*this, afterPeriod, omegaAfterPeriod, period, COAST_STEPS_PER_PERIOD);
+
+    const Vector3 I_axis = IB_orientation.rotate(B_H).normalized();
+    const Quaternion perPeriod = afterPeriod * IB_orientation.conjugate();
+    const double anglePerPeriod = 2.0 * std::atan2(perPeriod.vector().dot(I_axis), perPeriod.getQ0());
+
+    // Whole periods in closed form, the remainder stepped
+    const double periods   = std::floor(duration / period);
+    const double remainder = duration - periods * period;
+    integrateTorqueFree(*this, IB_orientation, B_omega, remainder, stepsFor(remainder, period));
+
+    const double angle = std::remainder(periods * anglePerPeriod, 2.0 * PI);
+    IB_orientation = Quaternion::exp(I_axis * angle) * IB_orientation;
+    IB_orientation.normalize();
+}
+
+const Vector3& AttitudePropagator::inertia() const
+{
+    return inertia_;
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+double AttitudePropagator::nutationPeriod(const Vector3& B_omega) const
+{
+    // Principal moments sorted, I1 <= I2 <= I3
+    double I[3] = {inertia_.x, inertia_.y, inertia_.z};
+    std::sort(I, I + 3);
+
+    const Vector3 B_H = {inertia_.x * B_omega.x, inertia_.y * B_omega.y, inertia_.z * B_omega.z};
+    const double H2 = B_H.dot(B_H);         // |H|²
+    const double E2 = B_omega.dot(B_H);     // 2 × kinetic energy
+
+    // Polhode around the major axis (H² > 2E·I2) or around the minor axis
+    double rate2, m;
+    if (H2 > E2 * I[1])
+    {
+        rate2 = (I[2] - I[1]) * (H2 - E2 * I[0]) / (I[0] * I[1] * I[2]);
+        m     = (I[1] - I[0]) * (E2 * I[2] - H2) / ((I[2] - I[1]) * (H2 - E2 * I[0]));
+    }
+    else if (H2 < E2 * I[1])
+    {
+        rate2 = (I[1] - I[0]) * (E2 * I[2] - H2) / (I[0] * I[1] * I[2]);
+        m     = (I[2] - I[1]) * (H2 - E2 * I[0]) / ((I[1] - I[0]) * (E2 * I[2] - H2));
+    }
+    else
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    if (!(rate2 > 0.0) || !(m < 1.0))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // Complete elliptic integral K(m) from the arithmetic-geometric mean
+    double a = 1.0;
+    double b = std::sqrt(1.0 - std::max(0.0, m));
+    while (std::abs(a - b) > 1e-15 * a)
+    {
+        const double mean = 0.5 * (a + b);
+        b = std::sqrt(a * b);
+        a = mean;
+    }
+    const double K = PI / (2.0 * a);
+
+    return 4.0 * K / std::sqrt(rate2);
+}
@@ -1,11 +1,19 @@
 #include "Integrators/eulerIntegrator.h"
+#include "dual.h"
 
-Vector3 EulerIntegrator::integrateVel(const Vector3& vel, const Vector3& acc, double dt) const
+template<typename T>
+Vector3T<T> EulerIntegratorT<T>::integrateVel(const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const
 {
     return vel + acc * dt;
 }
 
-Vector3 EulerIntegrator::integratePos(const Vector3& pos, const Vector3& vel, const Vector3& acc, double dt) const
+template<typename T>
+Vector3T<T> EulerIntegratorT<T>::integratePos(const Vector3T<T>& pos, const Vector3T<T>& vel, const Vector3T<T>& acc, T dt) const
 {
-    return pos + vel * dt + acc * 0.5 * dt * dt;
+    return pos + vel * dt + acc * T(0.5) * dt * dt;
 }
+
+// explicit instantiations
+template class EulerIntegratorT<double>;
+template class EulerIntegratorT<float>;
+template class EulerIntegratorT<SensitivityScalar>;
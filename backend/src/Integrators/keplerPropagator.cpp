@@ -0,0 +1,211 @@
+#include "Integrators/keplerPropagator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr double TWO_PI = 6.283185307179586;
+
+    /// |alpha * r0| below this is treated as a parabola
+    constexpr double PARABOLIC_TOLERANCE = 1e-12;
+
+    /// Order of the Laguerre iteration for the universal anomaly
+    constexpr double LAGUERRE_ORDER = 5.0;
+    constexpr int MAX_ITERATIONS = 50;
+}
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+KeplerPropagator::KeplerPropagator(double mu) : mu_(mu)
+{
+}
+
+void KeplerPropagator::propagate(Vector3& pos, Vector3& vel, double dt) const
+{
+    if (dt == 0.0)
+        return;
+
+    const double sqrtMu = std::sqrt(mu_);
+    const double r0     = pos.norm();
+    const double sigma0 = pos.dot(vel) / sqrtMu;
+    const double alpha  = 2.0 / r0 - vel.dot(vel) / mu_;
+
+    // Closed orbits repeat, so long coasts reduce to less than one period
+    if (alpha * r0 > PARABOLIC_TOLERANCE)
+    {
+        const double period = TWO_PI / (sqrtMu * alpha * std::sqrt(alpha));
+        dt = std::fmod(dt, period);
+    }
+
+    // --- Initial guess for the universal anomaly ---
+    double chi;
+    if (alpha * r0 > PARABOLIC_TOLERANCE)
+    {
+        chi = sqrtMu * alpha * dt;
+    }
+    else if (alpha * r0 < -PARABOLIC_TOLERANCE)
+    {
+        const double a   = 1.0 / alpha;
+        const double sgn = dt > 0.0 ? 1.0 : -1.0;
+        const double arg = (-2.0 * mu_ * alpha * dt) / (pos.dot(vel) + sgn * std::sqrt(-mu_ * a) * (1.0 - r0 * alpha));
+        chi = arg > 0.0 ? sgn * std::sqrt(-a) * std::log(arg) : sqrtMu * dt / r0;
+    }
+    else
+    {
+        chi = sqrtMu * dt / r0;
+    }
+
+    // --- Solve the universal Kepler equation (Laguerre-Conway) ---
+    double c = 0.5, s = 1.0 / 6.0;
+    for (int i = 0; i < MAX_ITERATIONS; ++i)
+    {
+        const double z    = alpha * chi * chi;
+        stumpff(z, c, s);
+
+        const double chi2 = chi * chi;
+        const double f    = sigma0 * chi2 * c + (1.0 - alpha * r0) * chi2 * chi * s + r0 * chi - sqrtMu * dt;
+        const double df   = sigma0 * chi * (1.0 - z * s) + (1.0 - alpha * r0) * chi2 * c + r0;
+        const double ddf  = sigma0 * (1.0 - z * c) + (1.0 - alpha * r0) * chi * (1.0 - z * s);
+
+        const double n    = LAGUERRE_ORDER;
+        const double root = std::sqrt(std::abs((n - 1.0) * (n - 1.0) * df * df - n * (n - 1.0) * f * ddf));
+        const double step = n * f / (df + (df >= 0.0 ? root : -root));
+
+        chi -= step;
+
+        if (std::abs(step) <= 1e-13 * std::max(1.0, std::abs(chi)))
+            break;
+    }
+
+    // --- Lagrange coefficients ---
+    const double z    = alpha * chi * chi;
+    stumpff(z, c, s);
+
+    const double chi2 = chi * chi;
+    const double f    = 1.0 - chi2 / r0 * c;
+    const double g    = dt - chi2 * chi / sqrtMu * s;
+
+    const Vector3 newPos = pos * f + vel * g;
+    const double r       = newPos.norm();
+
+    const double fDot = sqrtMu / (r * r0) * chi * (z * s - 1.0);
+    const double gDot = 1.0 - chi2 / r * c;
+
+    vel = pos * fDot + vel * gDot;
+    pos = newPos;
+}
+
+double KeplerPropagator::timeToRadius(const Vector3& pos, const Vector3& vel, double radius) const
+{
+    const double sqrtMu = std::sqrt(mu_);
+    const double r0     = pos.norm();
+    const double rv     = pos.dot(vel);
+    const double v2     = vel.dot(vel);
+    const double alpha  = 2.0 / r0 - v2 / mu_;
+
+    const Vector3 eVec = (pos * (v2 - mu_ / r0) - vel * rv) / mu_;
+    const double e     = eVec.norm();
+
+    double best = NEVER;
+
+    if (alpha * r0 > PARABOLIC_TOLERANCE)
+    {
+        // Ellipse: r = a (1 - e cos E)
+        const double a       = 1.0 / alpha;
+        const double n       = sqrtMu * alpha * std::sqrt(alpha);
+        const double period  = TWO_PI / n;
+
+        if (e <= 0.0)
+            return NEVER;
+
+        const double cosE1 = (1.0 - radius / a) / e;
+        if (cosE1 < -1.0 || cosE1 > 1.0)
+            return NEVER;
+
+        const double eSinE0 = rv / std::sqrt(mu_ * a);
+        const double eCosE0 = 1.0 - r0 / a;
+        const double M0     = std::atan2(eSinE0, eCosE0) - eSinE0;
+
+        const double E1 = std::acos(cosE1);
+        for (const double E : {E1, -E1})
+        {
+            double t = std::fmod((E - e * std::sin(E) - M0) / n, period);
+            if (t < 0.0)
+                t += period;
+            best = std::min(best, t);
+        }
+    }
+    else if (alpha * r0 < -PARABOLIC_TOLERANCE)
+    {
+        // Hyperbola: r = a (1 - e cosh H) with a < 0
+        const double a = 1.0 / alpha;
+        const double n = sqrtMu * (-alpha) * std::sqrt(-alpha);
+
+        const double coshH1 = (1.0 - radius / a) / e;
+        if (coshH1 < 1.0)
+            return NEVER;
+
+        const double eSinhH0 = rv / std::sqrt(-mu_ * a);
+        const double M0      = eSinhH0 - std::asinh(eSinhH0 / e);
+
+        const double H1 = std::acosh(coshH1);
+        for (const double H : {H1, -H1})
+        {
+            const double t = (e * std::sinh(H) - H - M0) / n;
+            if (t >= 0.0)
+                best = std::min(best, t);
+        }
+    }
+    else
+    {
+        // Parabola: r(chi) = chi^2 / 2 + sigma0 chi + r0 is quadratic in the universal anomaly
+        const double sigma0 = rv / sqrtMu;
+        const double disc   = sigma0 * sigma0 - 2.0 * (r0 - radius);
+        if (disc < 0.0)
+            return NEVER;
+
+        const double root = std::sqrt(disc);
+        for (const double chi : {-sigma0 - root, -sigma0 + root})
+        {
+            if (chi >= 0.0)
+            {
+                const double t = (sigma0 * chi * chi / 2.0 + chi * chi * chi / 6.0 + r0 * chi) / sqrtMu;
+                best = std::min(best, t);
+            }
+        }
+    }
+
+    return best;
+}
+
+double KeplerPropagator::mu() const
+{
+    return mu_;
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+void KeplerPropagator::stumpff(double z, double& c, double& s)
+{
+    if (z > 1e-3)
+    {
+        const double sz = std::sqrt(z);
+        c = (1.0 - std::cos(sz)) / z;
+        s = (sz - std::sin(sz)) / (z * sz);
+    }
+    else if (z < -1e-3)
+    {
+        const double sz = std::sqrt(-z);
+        c = (std::cosh(sz) - 1.0) / (-z);
+        s = (std::sinh(sz) - sz) / (-z * sz);
+    }
+    else
+    {
+        // Series expansion avoids cancellation near z = 0
+        c = 1.0 / 2.0 - z / 24.0 + z * z / 720.0 - z * z * z / 40320.0;
+        s = 1.0 / 6.0 - z / 120.0 + z * z / 5040.0 - z * z * z / 362880.0;
+    }
+}
@@ -0,0 +1,280 @@
+#include "Navigation/navigationFilter.h"
+#include "Integrators/keplerPropagator.h"
+#include "Terrain/sphericalTerrainModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    /// Index of the first position, velocity and the mass component in the state
+    constexpr std::size_t POS  = 0;
+    constexpr std::size_t VEL  = 3;
+    constexpr std::size_t MASS = 6;
+
+    /// [-] Finite-difference step of the coast transition, relative to |r| and the circular speed
+    constexpr double KEPLER_DIFFERENCE_STEP = 1e-5;
+
+    /// Gravity gradient ∂g/∂r = -μ/|r|³ (I - 3 r̂r̂ᵀ) of a point mass
+    Matrix3 gravityGradient(const Vector3& r, double mu)
+    {
+        const double rn  = r.norm();
+        const Vector3 u  = r / rn;
+        const double k   = -mu / (rn * rn * rn);
+
+        const Matrix<3, 1> c = Matrix<3, 1>::column(u);
+        return (Matrix3::identity() - (c * c.transpose()) * 3.0) * k;
+    }
+
+    /// Writes a 3 × 3 block into a state matrix
+    void setBlock(NavigationFilter::Covariance& m, std::size_t row, std::size_t col, const Matrix3& b)
+    {
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                m(row + i, col + j) = b(i, j);
+    }
+}
+
+NavigationFilter::NavigationFilter(const EnvironmentConfig& cfg, const NavigationNoise& noise)
+    : configData(cfg), noise_(noise), terrain_(std::make_shared<SphericalTerrainModel>())
+{}
+
+void NavigationFilter::setTerrainModel(std::shared_ptr<const ITerrainModel> terrain)
+{
+    terrain_ = terrain ? std::move(terrain) : std::make_shared<SphericalTerrainModel>();
+}
+
+void NavigationFilter::initialize(const Vector3& I_position, const Vector3& I_velocity, double mass)
+{
+    x_.setSegment3(POS, I_position);
+    x_.setSegment3(VEL, I_velocity);
+    x_[MASS] = mass;
+
+    const double sp = noise_.initialPositionSigma;
+    const double sv = noise_.initialVelocitySigma;
+    const double sm = noise_.initialMassSigma;
+
+    P_ = Covariance::zero();
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        P_(POS + i, POS + i) = sp * sp;
+        P_(VEL + i, VEL + i) = sv * sv;
+    }
+    P_(MASS, MASS) = sm * sm;
+}
+
+void NavigationFilter::predict(const Vector3& B_specificForce, const Quaternion& IB_orientation, double massFlow, double dt)
+{
+    if (dt <= 0.0)
+    {
+        return;
+    }
+
+    const Vector3 r = x_.segment3(POS);
+    const Vector3 v = x_.segment3(VEL);
+
+    // --- Mean ---
+    const Vector3 gravity      = r * (-configData.muMoon / std::pow(r.norm(), 3));
+    const Vector3 acceleration = IB_orientation.rotate(B_specificForce) + gravity;
+    const Vector3 newVelocity  = v + acceleration * dt;
+
+    x_.setSegment3(VEL, newVelocity);
+    x_.setSegment3(POS, r + newVelocity * dt);
+    x_[MASS] = std::max(0.0, x_[MASS] - massFlow * dt);
+
+    // --- Covariance, Φ = I + F·dt with the gravity gradient ---
+    const Matrix3 Gdt = gravityGradient(r, configData.muMoon) * dt;
+
+    Covariance Phi = Covariance::identity();
+    setBlock(Phi, POS, VEL, Matrix3::identity() * dt);
+    setBlock(Phi, VEL, POS, Gdt);
+
+    P_ = Phi * P_ * Phi.transpose();
+
+    // White acceleration noise integrated over the step
+    const double qa = noise_.accelerationNoise * noise_.accelerationNoise;
+    const double qm = noise_.massFlowNoise * noise_.massFlowNoise;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        P_(POS + i, POS + i) += qa * dt * dt * dt / 3.0;
+        P_(POS + i, VEL + i) += qa * dt * dt / 2.0;
+        P_(VEL + i, POS + i) += qa * dt * dt / 2.0;
+        P_(VEL + i, VEL + i) += qa * dt;
+    }
+    P_(MASS, MASS) += qm * dt;
+}
+
+void NavigationFilter::coast(double mu, double duration)
+{
+    if (duration <= 0.0)
+    {
+        return;
+    }
+
+    const KeplerPropagator kepler(mu);
+    const Vector3 r0 = x_.segment3(POS);
+    const Vector3 v0 = x_.segment3(VEL);
+
+    // --- Transition of the Kepler flow, central differences of the closed-form propagation ---
+    // Steps relative to the orbit scale; the truncation error is of order 1e-10
+    const double positionStep = KEPLER_DIFFERENCE_STEP * r0.norm();
+    const double velocityStep = KEPLER_DIFFERENCE_STEP * std::sqrt(mu / r0.norm());
+
+    Covariance Phi = Covariance::identity();
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        const double h = j < VEL ? positionStep : velocityStep;
+
+        State plus  = x_;
+        State minus = x_;
+        plus[j]  += h;
+        minus[j] -= h;
+
+        Vector3 rp = plus.segment3(POS),  vp = plus.segment3(VEL);
+        Vector3 rm = minus.segment3(POS), vm = minus.segment3(VEL);
+        kepler.propagate(rp, vp, duration);
+        kepler.propagate(rm, vm, duration);
+
+        const Vector3 dr = (rp - rm) / (2.0 * h);
+        const Vector3 dv = (vp - vm) / (2.0 * h);
+        Phi(POS + 0, j) = dr.x;
+        Phi(POS + 1, j) = dr.y;
+        Phi(POS + 2, j) = dr.z;
+        Phi(VEL + 0, j) = dv.x;
+        Phi(VEL + 1, j) = dv.y;
+        Phi(VEL + 2, j) = dv.z;
+    }
+
+    // --- Mean ---
+    Vector3 r = r0;
+    Vector3 v = v0;
+    kepler.propagate(r, v, duration);
+    x_.setSegment3(POS, r);
+    x_.setSegment3(VEL, v);
+
+    P_ = Phi * P_ * Phi.transpose();
+
+    const double T = duration;
+    const double qa = noise_.accelerationNoise * noise_.accelerationNoise;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        P_(POS + i, POS + i) += qa * T * T * T / 3.0;
+        P_(POS + i, VEL + i) += qa * T * T / 2.0;
+        P_(VEL + i, POS + i) += qa * T * T / 2.0;
+        P_(VEL + i, VEL + i) += qa * T;
+    }
+}
+
+bool NavigationFilter::updateRadar(double range, const Quaternion& IB_orientation)
+{
+    const Vector3 r  = x_.segment3(POS);
+    const Vector3 up = r.normalized();
+
+    // Beam along body -z; cosine of its angle to the local vertical
+    const double cosTilt = IB_orientation.rotateInverse(up).z;
+    if (cosTilt < 0.1)
+    {
+        return false;
+    }
+
+    const double predicted = altitude() / cosTilt;
+
+    // Terrain slope and the change of tilt with position are neglected
+    State H{};
+    H.setSegment3(POS, up / cosTilt);
+
+    const double sigma = noise_.radarNoise + noise_.radarNoiseScale * std::max(0.0, predicted);
+    return scalarUpdate(H, range - predicted, sigma * sigma);
+}
+
+int NavigationFilter::updateVelocimeter(const Vector3& B_velocity, const Quaternion& IB_orientation)
+{
+    const double measured[3] = {B_velocity.x, B_velocity.y, B_velocity.z};
+    const Matrix3 R = Matrix3::rotation(IB_orientation);
+
+    const double sigma = noise_.velocimeterNoise + noise_.velocimeterNoiseScale * x_.segment3(VEL).norm();
+
+    int accepted = 0;
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        // Body axis k expressed in the Moon frame: column k of R
+        const Vector3 axis{R(0, k), R(1, k), R(2, k)};
+
+        State H{};
+        H.setSegment3(VEL, axis);
+
+        const double predicted = axis.dot(x_.segment3(VEL));
+        if (scalarUpdate(H, measured[k] - predicted, sigma * sigma))
+        {
+            ++accepted;
+        }
+    }
+    return accepted;
+}
+
+void NavigationFilter::process(const SensorReadings& readings, const Quaternion& IB_orientation, double massFlow, double dt)
+{
+    if (readings.imuUpdated)
+    {
+        predict(readings.B_specificForce, IB_orientation, massFlow, dt);
+    }
+    if (readings.radarUpdated)
+    {
+        updateRadar(readings.radarRange, IB_orientation);
+    }
+    if (readings.velocimeterUpdated)
+    {
+        updateVelocimeter(readings.B_velocity, IB_orientation);
+    }
+}
+
+NavigationEstimate NavigationFilter::estimate() const
+{
+    NavigationEstimate e;
+    e.I_position = x_.segment3(POS);
+    e.I_velocity = x_.segment3(VEL);
+    e.mass       = x_[MASS];
+    e.altitude   = altitude();
+    return e;
+}
+
+double NavigationFilter::altitude() const
+{
+    const Vector3 r = x_.segment3(POS);
+    return r.norm() - configData.radiusMoon - terrain_->heightAt(r);
+}
+
+const NavigationFilter::Covariance& NavigationFilter::covariance() const
+{
+    return P_;
+}
+
+NavigationFilter::Checkpoint NavigationFilter::captureCheckpoint() const
+{
+    return {x_, P_};
+}
+
+void NavigationFilter::restoreCheckpoint(const Checkpoint& checkpoint)
+{
+    x_ = checkpoint.x;
+    P_ = checkpoint.P;
+}
+
+bool NavigationFilter::scalarUpdate(const State& H, double residual, double variance)
+{
+    const State PH   = P_ * H;
+    const double s   = H.dot(PH) + variance;
+
+    if (residual * residual > GATE * GATE * s)
+    {
+        return false;
+    }
+
+    const State K = PH / s;
+    x_ += K * residual;
+
+    // P -= K (PH)ᵀ, kept symmetric against rounding
+    P_ -= K * PH.transpose();
+    P_ = P_.symmetrized();
+    return true;
+}
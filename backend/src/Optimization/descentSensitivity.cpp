@@ -0,0 +1,145 @@
+#include "Optimization/descentSensitivity.h"
+#include "Controller/pd_controller.h"
+#include "Physics/basicMoonGravityModel.h"
+#include "Integrators/eulerIntegrator.h"
+#include "Thrust/BasicMainEngineModel.h"
+
+#include <stdexcept>
+
+namespace
+{
+    using S = SensitivityScalar;
+
+    /// Seeds parameter @p p with value @p v
+    S seed(double v, SensitivityParameter p)
+    {
+        return S::variable(v, static_cast<std::size_t>(p));
+    }
+
+    /// Copies value and gradient of a dual number into a result
+    void store(const S& x, double& value, std::array<double, SENSITIVITY_PARAMETERS>& grad)
+    {
+        value = x.value;
+        grad  = x.grad;
+    }
+}
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+DescentSensitivity::DescentSensitivity(const EnvironmentConfig& environment, const customSpacecraft& lander, const DescentGains& gains)
+    : environment_(environment), lander_(lander), gains_(gains)
+{
+    if (lander_.engines_.empty())
+    {
+        throw std::runtime_error("DescentSensitivity: lander has no engine");
+    }
+}
+
+DescentSensitivityResult DescentSensitivity::run(double dt, double maxTime) const
+{
+    if (dt <= 0.0)
+    {
+        throw std::runtime_error("DescentSensitivity: dt must be positive");
+    }
+
+    const EngineConfig& engine = lander_.engines_[0];
+
+    // --- Traced parameters ---
+    const S maxThrust = seed(engine.maxThrust, SensitivityParameter::MaxThrust);
+    const S Isp       = seed(engine.Isp, SensitivityParameter::Isp);
+    const S emptyMass = seed(lander_.emptyMass, SensitivityParameter::EmptyMass);
+
+    DescentGainsT<S> gains;
+    gains.k_r_A     = gains_.k_r_A;
+    gains.k_r_B     = gains_.k_r_B;
+    gains.k_r_C     = gains_.k_r_C;
+    gains.k_r_D     = gains_.k_r_D;
+    gains.Kp_min    = seed(gains_.Kp_min, SensitivityParameter::ProportionalGain);
+    gains.Kp_max    = gains_.Kp_max;
+    gains.Kp_scale  = gains_.Kp_scale;
+    gains.Kd_min    = seed(gains_.Kd_min, SensitivityParameter::DerivativeGain);
+    gains.Kd_max    = gains_.Kd_max;
+    gains.Kd_scale  = gains_.Kd_scale;
+
+    // --- Models of the simulation step ---
+    AdaptiveDescentController autopilot(lander_.safeVelocity);
+    PD_ControllerT<S> controller;
+    BasicMoonGravityModelT<S> gravity(environment_);
+    EulerIntegratorT<S> integrator;
+
+    // Fuel of all tanks, as in spacecraft::getTotalFuelMass
+    double initialFuel = 0.0;
+    for (const FuelTank& tank : lander_.tanks_)
+    {
+        initialFuel += tank.mass;
+    }
+    if (lander_.tanks_.empty())
+    {
+        initialFuel = lander_.fuelM;
+    }
+
+    // --- State ---
+    Vector3T<S> position    = lander_.I_initialPos.cast<S>();
+    Vector3T<S> velocity    = lander_.I_initialVelocity.cast<S>();
+    const Vector3T<S> direction = engine.direction.cast<S>();
+    S fuel          = initialFuel;
+    S thrust        = 0.0;
+    S time          = 0.0;
+
+    // Autopilot mass as passed by simcontrol::runAutopilot
+    const S autopilotMass = emptyMass + lander_.fuelM;
+    const S step = dt;
+
+    auto altitude = [&](const Vector3T<S>& pos) { return pos.norm() - environment_.radiusMoon; };
+
+    DescentSensitivityResult result;
+    S h = altitude(position);
+
+    while (time < maxTime)
+    {
+        // --- Autopilot (simcontrol::runAutopilot), with perfect navigation ---
+        S command = autopilot.computeThrust<S>(&controller, gains, maxThrust, velocity.z, h, step, autopilotMass, S(environment_.moonGravity));
+        S target  = (command / maxThrust) * maxThrust;
+
+        // --- Propulsion (spacecraft::updateStep) ---
+        const S mass        = emptyMass + fuel;
+        const S fuelBefore  = fuel;
+        if (fuel > 0.0)
+        {
+            thrust = basicMainEngineModel::calcThrustResponse(thrust, target, step, S(engine.timeConstant));
+            S massFlow = basicMainEngineModel::calcMassFlow(thrust, Isp, S(environment_.earthGravity));
+            fuel = basicMainEngineModel::calcRemainingFuel(fuel, massFlow, step);
+        }
+
+        // --- Translation (spacecraft::updateMovementData) ---
+        const Vector3T<S> thrustVector = -(direction * thrust);
+        const Vector3T<S> acceleration = gravity.computeAcceleration(position, velocity, mass, thrustVector);
+        const Vector3T<S> newVelocity  = integrator.integrateVel(velocity, acceleration, step);
+        const Vector3T<S> newPosition  = integrator.integratePos(position, newVelocity, acceleration, step);
+        const S newH = altitude(newPosition);
+
+        if (newH <= 0.0)
+        {
+            // Fraction of the step at which the surface is reached
+            const S s = h / (h - newH);
+
+            result.touchedDown  = true;
+            result.touchdownTime = (time + s * step).value;
+            store(velocity.z + s * (newVelocity.z - velocity.z), result.touchdownVelocity, result.dTouchdownVelocity);
+            store(S(initialFuel) - (fuelBefore + s * (fuel - fuelBefore)), result.fuelUsed, result.dFuelUsed);
+            return result;
+        }
+
+        velocity = newVelocity;
+        position = newPosition;
+        h        = newH;
+        time    += step;
+    }
+
+    // No contact: report the state at maxTime
+    result.touchdownTime = time.value;
+    store(velocity.z, result.touchdownVelocity, result.dTouchdownVelocity);
+    store(S(initialFuel) - fuel, result.fuelUsed, result.dFuelUsed);
+    return result;
+}
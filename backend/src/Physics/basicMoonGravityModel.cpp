@@ -1,26 +1,40 @@
 #include "Physics/basicMoonGravityModel.h"
+#include "dual.h"
 
 //******************************************************
 //************* PUBLIC *********************************
 //******************************************************
-Vector3 BasicMoonGravityModel::computeAcceleration(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const
+template<typename T>
+Vector3T<T> BasicMoonGravityModelT<T>::computeAcceleration(const Vector3T<T>& pos, const Vector3T<T>& /*vel*/, T mass, const Vector3T<T>& thrust) const
 {
-    Vector3 gravity = calcAccelerationAlignedToCenterOfMoon(pos);
-    Vector3 thrustAcc = thrust/mass;
+    Vector3T<T> gravity = calcAccelerationAlignedToCenterOfMoon(pos);
+    Vector3T<T> thrustAcc = thrust/mass;
     return gravity + thrustAcc;
 }
 
+template<typename T>
+std::optional<T> BasicMoonGravityModelT<T>::pointMassParameter() const
+{
+    return static_cast<T>(configData.muMoon);
+}
+
 //******************************************************
 //************* PRIVATE ********************************
 //******************************************************
-Vector3 BasicMoonGravityModel::calcAccelerationAlignedToCenterOfMoon(const Vector3& pos) const
+template<typename T>
+Vector3T<T> BasicMoonGravityModelT<T>::calcAccelerationAlignedToCenterOfMoon(const Vector3T<T>& pos) const
 {
     //Vector3 dir = pos.normalized();
     //double r = pos.norm();
 
-    Vector3 r       = pos;
-    double rNorm    = r.norm();
-    double r3       = rNorm * rNorm * rNorm;
+    Vector3T<T> r   = pos;
+    T rNorm         = r.norm();
+    T r3            = rNorm * rNorm * rNorm;
 
-    return - r * (configData.muMoon / (r3));
+    return - r * (static_cast<T>(configData.muMoon) / (r3));
 }
+
+// explicit instantiations
+template class BasicMoonGravityModelT<double>;
+template class BasicMoonGravityModelT<float>;
+template class BasicMoonGravityModelT<SensitivityScalar>;
@@ -0,0 +1,163 @@
+#include "Physics/cachedGravityModel.h"
+
+#include <atomic>
+#include <cmath>
+
+namespace
+{
+std::atomic<std::uint64_t> nextCacheId{1};
+}
+
+thread_local CachedGravityModel::Hint CachedGravityModel::hint_;
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+CachedGravityModel::CachedGravityModel(std::shared_ptr<const IPhysicsModel> inner, double mu, const CachedGravityConfig& config)
+    : inner_(std::move(inner)),
+    mu_(mu),
+    config_(config),
+    id_(nextCacheId.fetch_add(1))
+{
+}
+
+Vector3 CachedGravityModel::computeAcceleration(const Vector3& pos, const Vector3& /*vel*/, double mass, const Vector3& thrust) const
+{
+    Vector3 gravity = gravityAcceleration(pos);
+    Vector3 thrustAcc = thrust/mass;
+    return gravity + thrustAcc;
+}
+
+Vector3 CachedGravityModel::gravityAcceleration(const Vector3& pos) const
+{
+    const Cell& cell = leafAt(pos);
+    const double inv = 1.0 / cell.size;
+
+    return pointMass(pos) + interpolate(cell,
+                                        (pos.x - cell.origin.x) * inv,
+                                        (pos.y - cell.origin.y) * inv,
+                                        (pos.z - cell.origin.z) * inv);
+}
+
+std::size_t CachedGravityModel::cellCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cells_.size();
+}
+
+void CachedGravityModel::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cells_.clear();
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+std::size_t CachedGravityModel::CellKeyHash::operator()(const CellKey& key) const
+{
+    std::uint64_t h = static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.i)) * 0x9E3779B97F4A7C15ULL
+                    ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.j)) * 0xC2B2AE3D27D4EB4FULL
+                    ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.k)) * 0x165667B19E3779F9ULL
+                    ^ static_cast<std::uint64_t>(key.level);
+    h ^= h >> 32;
+    return static_cast<std::size_t>(h);
+}
+
+const CachedGravityModel::Cell& CachedGravityModel::leafAt(const Vector3& pos) const
+{
+    if (hint_.owner == id_ && hint_.cell->contains(pos))
+        return *hint_.cell;
+
+    CellPtr cell;
+    for (int level = 0; level <= config_.maxLevel; ++level)
+    {
+        const double size = config_.cellSize / static_cast<double>(1 << level);
+
+        CellKey key;
+        key.level = level;
+        key.i = static_cast<std::int32_t>(std::floor(pos.x / size));
+        key.j = static_cast<std::int32_t>(std::floor(pos.y / size));
+        key.k = static_cast<std::int32_t>(std::floor(pos.z / size));
+
+        cell = findOrBuild(key);
+        if (!cell->refined)
+            break;
+    }
+
+    hint_.owner = id_;
+    hint_.cell  = std::move(cell);
+    return *hint_.cell;
+}
+
+CachedGravityModel::CellPtr CachedGravityModel::findOrBuild(const CellKey& key) const
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cells_.find(key);
+        if (it != cells_.end())
+            return it->second;
+    }
+
+    // Build without holding the lock; the inner model may be slow
+    CellPtr cell = buildCell(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cells_.size() >= config_.maxCells)
+    {
+        // Flush instead of tracking usage; cells in use stay alive through their hints
+        cells_.clear();
+    }
+    return cells_.emplace(key, std::move(cell)).first->second;
+}
+
+CachedGravityModel::CellPtr CachedGravityModel::buildCell(const CellKey& key) const
+{
+    auto cell = std::make_shared<Cell>();
+    cell->size      = config_.cellSize / static_cast<double>(1 << key.level);
+    cell->origin    = {key.i * cell->size, key.j * cell->size, key.k * cell->size};
+
+    for (int c = 0; c < 8; ++c)
+    {
+        const Vector3 corner = { cell->origin.x + ((c & 1) ? cell->size : 0.0),
+                                 cell->origin.y + ((c & 2) ? cell->size : 0.0),
+                                 cell->origin.z + ((c & 4) ? cell->size : 0.0) };
+        cell->corners[c] = residual(corner);
+    }
+
+    // Error check at the center, the point farthest from all samples
+    if (key.level < config_.maxLevel)
+    {
+        const Vector3 center = cell->origin + Vector3{0.5, 0.5, 0.5} * cell->size;
+        const Vector3 error  = residual(center) - interpolate(*cell, 0.5, 0.5, 0.5);
+        cell->refined = error.norm() > config_.tolerance;
+    }
+
+    return cell;
+}
+
+Vector3 CachedGravityModel::residual(const Vector3& pos) const
+{
+    const Vector3 zero = {0.0, 0.0, 0.0};
+    return inner_->computeAcceleration(pos, zero, 1.0, zero) - pointMass(pos);
+}
+
+Vector3 CachedGravityModel::pointMass(const Vector3& pos) const
+{
+    const double r2 = pos.dot(pos);
+    const double r  = std::sqrt(r2);
+    return pos * (-mu_ / (r2 * r));
+}
+
+Vector3 CachedGravityModel::interpolate(const Cell& cell, double fx, double fy, double fz)
+{
+    const auto& c = cell.corners;
+
+    const Vector3 x00 = c[0] + (c[1] - c[0]) * fx;
+    const Vector3 x10 = c[2] + (c[3] - c[2]) * fx;
+    const Vector3 x01 = c[4] + (c[5] - c[4]) * fx;
+    const Vector3 x11 = c[6] + (c[7] - c[6]) * fx;
+    const Vector3 y0  = x00 + (x10 - x00) * fy;
+    const Vector3 y1  = x01 + (x11 - x01) * fy;
+    return y0 + (y1 - y0) * fz;
+}
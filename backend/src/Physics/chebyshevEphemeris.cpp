@@ -0,0 +1,207 @@
+#include "Physics/chebyshevEphemeris.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+ChebyshevEphemeris::ChebyshevEphemeris(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("ChebyshevEphemeris: cannot open " + path);
+    }
+
+    int coefficients = 0;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream in(line);
+        std::string key;
+        in >> key;
+
+        if (key == "GM")
+        {
+            in >> gm_;
+        }
+        else if (key == "COEFFICIENTS")
+        {
+            in >> coefficients;
+        }
+        else
+        {
+            if (coefficients <= 0)
+            {
+                throw std::runtime_error("ChebyshevEphemeris: COEFFICIENTS missing before segments in " + path);
+            }
+
+            std::istringstream record(line);
+            Segment segment;
+            segment.cx.resize(coefficients);
+            segment.cy.resize(coefficients);
+            segment.cz.resize(coefficients);
+
+            record >> segment.t0 >> segment.t1;
+            for (double& c : segment.cx) record >> c;
+            for (double& c : segment.cy) record >> c;
+            for (double& c : segment.cz) record >> c;
+
+            if (!record || segment.t1 <= segment.t0)
+            {
+                throw std::runtime_error("ChebyshevEphemeris: malformed segment in " + path);
+            }
+            segments_.push_back(std::move(segment));
+        }
+    }
+
+    if (segments_.empty())
+    {
+        throw std::runtime_error("ChebyshevEphemeris: no segments in " + path);
+    }
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(const ChebyshevEphemeris& other)
+    : gm_(other.gm_),
+    segments_(other.segments_)
+{
+}
+
+ChebyshevEphemeris& ChebyshevEphemeris::operator=(const ChebyshevEphemeris& other)
+{
+    gm_         = other.gm_;
+    segments_   = other.segments_;
+    hint_.store(0, std::memory_order_relaxed);
+    return *this;
+}
+
+ChebyshevEphemeris ChebyshevEphemeris::fit(const std::function<Vector3(double)>& position, double gm,
+                                           double t0, double t1, double segmentLength, int coefficients)
+{
+    const double pi = 3.14159265358979323846;
+
+    ChebyshevEphemeris eph;
+    eph.gm_ = gm;
+
+    const int n = std::max(coefficients, 1);
+    std::vector<Vector3> samples(n);
+
+    for (double start = t0; start < t1; start += segmentLength)
+    {
+        Segment segment;
+        segment.t0 = start;
+        segment.t1 = std::min(start + segmentLength, t1);
+
+        // Sample at the Chebyshev nodes of the segment
+        const double mid  = 0.5 * (segment.t0 + segment.t1);
+        const double half = 0.5 * (segment.t1 - segment.t0);
+        for (int j = 0; j < n; ++j)
+        {
+            samples[j] = position(mid + half * std::cos(pi * (j + 0.5) / n));
+        }
+
+        segment.cx.assign(n, 0.0);
+        segment.cy.assign(n, 0.0);
+        segment.cz.assign(n, 0.0);
+        for (int k = 0; k < n; ++k)
+        {
+            const double scale = (k == 0 ? 1.0 : 2.0) / n;
+            for (int j = 0; j < n; ++j)
+            {
+                const double w = scale * std::cos(pi * k * (j + 0.5) / n);
+                segment.cx[k] += w * samples[j].x;
+                segment.cy[k] += w * samples[j].y;
+                segment.cz[k] += w * samples[j].z;
+            }
+        }
+
+        eph.segments_.push_back(std::move(segment));
+    }
+
+    return eph;
+}
+
+void ChebyshevEphemeris::save(const std::string& path) const
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("ChebyshevEphemeris: cannot write " + path);
+    }
+
+    const std::size_t n = segments_.empty() ? 0 : segments_.front().cx.size();
+
+    file << std::setprecision(17);
+    file << "# Chebyshev ephemeris, positions relative to moon center [m], time [s]\n";
+    file << "GM " << gm_ << "\n";
+    file << "COEFFICIENTS " << n << "\n";
+
+    for (const Segment& segment : segments_)
+    {
+        file << segment.t0 << ' ' << segment.t1;
+        for (double c : segment.cx) file << ' ' << c;
+        for (double c : segment.cy) file << ' ' << c;
+        for (double c : segment.cz) file << ' ' << c;
+        file << "\n";
+    }
+}
+
+Vector3 ChebyshevEphemeris::position(double t) const
+{
+    const Segment& segment = segments_[findSegment(t)];
+
+    double tau = 2.0 * (t - segment.t0) / (segment.t1 - segment.t0) - 1.0;
+    tau = std::clamp(tau, -1.0, 1.0);
+
+    return {clenshaw(segment.cx, tau), clenshaw(segment.cy, tau), clenshaw(segment.cz, tau)};
+}
+
+double ChebyshevEphemeris::startTime() const
+{
+    return segments_.empty() ? 0.0 : segments_.front().t0;
+}
+
+double ChebyshevEphemeris::endTime() const
+{
+    return segments_.empty() ? 0.0 : segments_.back().t1;
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+std::size_t ChebyshevEphemeris::findSegment(double t) const
+{
+    const std::size_t hint = hint_.load(std::memory_order_relaxed);
+    if (hint < segments_.size() && t >= segments_[hint].t0 && t < segments_[hint].t1)
+        return hint;
+
+    // First segment ending after t
+    auto it = std::upper_bound(segments_.begin(), segments_.end(), t,
+                               [](double time, const Segment& s) { return time < s.t1; });
+    const std::size_t index = (it == segments_.end()) ? segments_.size() - 1
+                                                      : static_cast<std::size_t>(it - segments_.begin());
+
+    hint_.store(index, std::memory_order_relaxed);
+    return index;
+}
+
+double ChebyshevEphemeris::clenshaw(const std::vector<double>& c, double tau)
+{
+    double b1 = 0.0;
+    double b2 = 0.0;
+    for (std::size_t k = c.size() - 1; k >= 1; --k)
+    {
+        const double b0 = c[k] + 2.0 * tau * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + tau * b1 - b2;
+}
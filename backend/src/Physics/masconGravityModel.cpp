@@ -0,0 +1,278 @@
+#include "Physics/masconGravityModel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+/// Maximum number of mascons in a leaf
+constexpr std::uint32_t LEAF_SIZE = 16;
+
+/// Depth limit, guards against coincident mascons
+constexpr int MAX_DEPTH = 24;
+
+/// Traversal stack size: at most 7 siblings remain per level plus one node
+constexpr int STACK_SIZE = 8 * (MAX_DEPTH + 1);
+
+int octant(const Vector3& p, const Vector3& center)
+{
+    return (p.x >= center.x ? 1 : 0) | (p.y >= center.y ? 2 : 0) | (p.z >= center.z ? 4 : 0);
+}
+}
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+MasconGravityModel::MasconGravityModel(const std::string& path, double mu, double theta)
+    : MasconGravityModel(loadMascons(path), mu, theta)
+{
+}
+
+MasconGravityModel::MasconGravityModel(const std::vector<Mascon>& mascons, double mu, double theta)
+    : mu_(mu),
+    theta_(theta)
+{
+    build(mascons);
+}
+
+Vector3 MasconGravityModel::computeAcceleration(const Vector3& pos, const Vector3& /*vel*/, double mass, const Vector3& thrust) const
+{
+    Vector3 gravity = gravityAcceleration(pos);
+    Vector3 thrustAcc = thrust/mass;
+    return gravity + thrustAcc;
+}
+
+Vector3 MasconGravityModel::gravityAcceleration(const Vector3& pos) const
+{
+    // Central body
+    const double r2 = pos.dot(pos);
+    const double r  = std::sqrt(r2);
+    Vector3 acc = pos * (-mu_ / (r2 * r));
+
+    if (nodes_.empty())
+        return acc;
+
+    const double theta2 = theta_ * theta_;
+
+    std::array<std::uint32_t, STACK_SIZE> stack;
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node& node = nodes_[stack[--top]];
+
+        const Vector3 d     = pos - node.center;
+        const double dist2  = d.dot(d);
+
+        if (node.size * node.size < theta2 * dist2)
+        {
+            // Far field: monopole + dipole about the node center
+            const double dist   = std::sqrt(dist2);
+            const double inv3   = 1.0 / (dist2 * dist);
+            const double inv5   = inv3 / dist2;
+            acc = acc - d * (node.monopole * inv3)
+                      + node.dipole * inv3
+                      - d * (3.0 * d.dot(node.dipole) * inv5);
+        }
+        else if (node.firstChild < 0)
+        {
+            acc = acc + directSum(pos, node.begin, node.end);
+        }
+        else
+        {
+            for (std::uint32_t c = 0; c < node.childCount; ++c)
+            {
+                stack[top++] = static_cast<std::uint32_t>(node.firstChild) + c;
+            }
+        }
+    }
+
+    return acc;
+}
+
+Vector3 MasconGravityModel::directAcceleration(const Vector3& pos) const
+{
+    const double r2 = pos.dot(pos);
+    const double r  = std::sqrt(r2);
+    return pos * (-mu_ / (r2 * r)) + directSum(pos, 0, static_cast<std::uint32_t>(gm_.size()));
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+std::vector<Mascon> MasconGravityModel::loadMascons(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("MasconGravityModel: cannot open " + path);
+    }
+
+    std::vector<Mascon> mascons;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream in(line);
+
+        Mascon m;
+        if (in >> m.position.x >> m.position.y >> m.position.z >> m.gm)
+        {
+            mascons.push_back(m);
+        }
+    }
+
+    return mascons;
+}
+
+void MasconGravityModel::build(std::vector<Mascon> mascons)
+{
+    nodes_.clear();
+    if (mascons.empty())
+        return;
+
+    // Bounding cube
+    Vector3 lo = mascons[0].position;
+    Vector3 hi = lo;
+    for (const Mascon& m : mascons)
+    {
+        lo = {std::min(lo.x, m.position.x), std::min(lo.y, m.position.y), std::min(lo.z, m.position.z)};
+        hi = {std::max(hi.x, m.position.x), std::max(hi.y, m.position.y), std::max(hi.z, m.position.z)};
+    }
+    const double size = std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z, 1.0});
+
+    nodes_.reserve(2 * mascons.size() / LEAF_SIZE + 1);
+    nodes_.emplace_back();
+    buildNode(mascons, 0, 0, static_cast<std::uint32_t>(mascons.size()), (lo + hi) * 0.5, size, 0);
+
+    // Structure of arrays in octree order for the near-field loop
+    x_.resize(mascons.size());
+    y_.resize(mascons.size());
+    z_.resize(mascons.size());
+    gm_.resize(mascons.size());
+    for (std::size_t i = 0; i < mascons.size(); ++i)
+    {
+        x_[i]  = mascons[i].position.x;
+        y_[i]  = mascons[i].position.y;
+        z_[i]  = mascons[i].position.z;
+        gm_[i] = mascons[i].gm;
+    }
+}
+
+void MasconGravityModel::buildNode(std::vector<Mascon>& mascons, std::uint32_t nodeIndex, std::uint32_t begin, std::uint32_t end,
+                                   const Vector3& boxCenter, double boxSize, int depth)
+{
+    // --- Expansion of this node ---
+    double monopole = 0.0;
+    double weight   = 0.0;
+    Vector3 weighted = {0.0, 0.0, 0.0};
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        monopole += mascons[i].gm;
+        weight   += std::abs(mascons[i].gm);
+        weighted = weighted + mascons[i].position * std::abs(mascons[i].gm);
+    }
+    const Vector3 center = (weight > 0.0) ? weighted / weight : boxCenter;
+
+    Vector3 dipole = {0.0, 0.0, 0.0};
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        dipole = dipole + (mascons[i].position - center) * mascons[i].gm;
+    }
+
+    {
+        Node& node      = nodes_[nodeIndex];
+        node.center     = center;
+        node.dipole     = dipole;
+        node.monopole   = monopole;
+        node.size       = boxSize;
+        node.begin      = begin;
+        node.end        = end;
+    }
+
+    if (end - begin <= LEAF_SIZE || depth >= MAX_DEPTH)
+        return;
+
+    // --- Partition into octants (counting sort) ---
+    std::array<std::uint32_t, 9> offsets{};
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        ++offsets[octant(mascons[i].position, boxCenter) + 1];
+    }
+    for (int o = 0; o < 8; ++o)
+    {
+        offsets[o + 1] += offsets[o];
+    }
+
+    std::vector<Mascon> sorted(end - begin);
+    std::array<std::uint32_t, 8> cursor;
+    std::copy(offsets.begin(), offsets.begin() + 8, cursor.begin());
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        sorted[cursor[octant(mascons[i].position, boxCenter)]++] = mascons[i];
+    }
+    std::copy(sorted.begin(), sorted.end(), mascons.begin() + begin);
+
+    // --- Children, stored consecutively ---
+    const auto firstChild = static_cast<std::int32_t>(nodes_.size());
+    std::uint32_t childCount = 0;
+    for (int o = 0; o < 8; ++o)
+    {
+        if (offsets[o + 1] > offsets[o])
+            ++childCount;
+    }
+    nodes_.resize(nodes_.size() + childCount);
+    nodes_[nodeIndex].firstChild = firstChild;
+    nodes_[nodeIndex].childCount = childCount;
+
+    const double half = boxSize * 0.5;
+    std::uint32_t child = 0;
+    for (int o = 0; o < 8; ++o)
+    {
+        if (offsets[o + 1] == offsets[o])
+            continue;
+
+        const Vector3 childCenter = { boxCenter.x + ((o & 1) ? 0.25 : -0.25) * boxSize,
+                                      boxCenter.y + ((o & 2) ? 0.25 : -0.25) * boxSize,
+                                      boxCenter.z + ((o & 4) ? 0.25 : -0.25) * boxSize };
+
+        buildNode(mascons, static_cast<std::uint32_t>(firstChild) + child, begin + offsets[o], begin + offsets[o + 1],
+                  childCenter, half, depth + 1);
+        ++child;
+    }
+}
+
+Vector3 MasconGravityModel::directSum(const Vector3& pos, std::uint32_t begin, std::uint32_t end) const
+{
+    const double* x  = x_.data();
+    const double* y  = y_.data();
+    const double* z  = z_.data();
+    const double* gm = gm_.data();
+
+    double ax = 0.0;
+    double ay = 0.0;
+    double az = 0.0;
+
+    #pragma omp simd reduction(+:ax, ay, az)
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        const double dx = pos.x - x[i];
+        const double dy = pos.y - y[i];
+        const double dz = pos.z - z[i];
+        const double d2 = dx * dx + dy * dy + dz * dz;
+        const double s  = gm[i] / (d2 * std::sqrt(d2));
+        ax -= dx * s;
+        ay -= dy * s;
+        az -= dz * s;
+    }
+
+    return {ax, ay, az};
+}
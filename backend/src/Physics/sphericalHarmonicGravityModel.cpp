@@ -0,0 +1,247 @@
+#include "Physics/sphericalHarmonicGravityModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+/// Per-thread scratch for the Cunningham functions
+thread_local std::vector<double> scratchV;
+thread_local std::vector<double> scratchW;
+
+/// @brief Splits a comma and/or whitespace separated line into numbers
+std::vector<double> parseNumbers(std::string line)
+{
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream in(line);
+
+    std::vector<double> values;
+    double value;
+    while (in >> value)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+}
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+SphericalHarmonicGravityModel::SphericalHarmonicGravityModel(const std::string& path, int maxDegree)
+{
+    loadShadr(path, maxDegree);
+    precompute();
+}
+
+Vector3 SphericalHarmonicGravityModel::computeAcceleration(const Vector3& pos, const Vector3& /*vel*/, double mass, const Vector3& thrust) const
+{
+    Vector3 gravity = gravityAcceleration(pos);
+    Vector3 thrustAcc = thrust/mass;
+    return gravity + thrustAcc;
+}
+
+Vector3 SphericalHarmonicGravityModel::gravityAcceleration(const Vector3& pos) const
+{
+    const int N = degree_;
+    const std::size_t size = index(N + 2, 0);
+
+    std::vector<double>& Vs = scratchV;
+    std::vector<double>& Ws = scratchW;
+    if (Vs.size() < size)
+    {
+        Vs.resize(size);
+        Ws.resize(size);
+    }
+    double* V = Vs.data();
+    double* W = Ws.data();
+
+    const double r2  = pos.dot(pos);
+    const double rho = radius_ / r2;
+    const double x0  = pos.x * rho;
+    const double y0  = pos.y * rho;
+    const double z0  = pos.z * rho;
+    const double rr  = radius_ * rho;
+
+    // --- Cunningham functions up to degree N+1, row by row ---
+    V[0] = radius_ / std::sqrt(r2);
+    W[0] = 0.0;
+
+    for (int n = 1; n <= N + 1; ++n)
+    {
+        double* Vn        = V + index(n, 0);
+        double* Wn        = W + index(n, 0);
+        const double* Vn1 = V + index(n - 1, 0);
+        const double* Wn1 = W + index(n - 1, 0);
+        const double* a   = alpha_.data() + index(n, 0);
+
+        if (n >= 2)
+        {
+            const double* Vn2 = V + index(n - 2, 0);
+            const double* Wn2 = W + index(n - 2, 0);
+            const double* b   = beta_.data() + index(n, 0);
+
+            #pragma omp simd
+            for (int m = 0; m <= n - 2; ++m)
+            {
+                Vn[m] = a[m] * z0 * Vn1[m] - b[m] * rr * Vn2[m];
+                Wn[m] = a[m] * z0 * Wn1[m] - b[m] * rr * Wn2[m];
+            }
+        }
+
+        // First sub-diagonal: V̄ₙ₋₂,ₙ₋₁ is zero
+        Vn[n - 1] = a[n - 1] * z0 * Vn1[n - 1];
+        Wn[n - 1] = a[n - 1] * z0 * Wn1[n - 1];
+
+        // Diagonal
+        Vn[n] = gamma_[n] * (x0 * Vn1[n - 1] - y0 * Wn1[n - 1]);
+        Wn[n] = gamma_[n] * (x0 * Wn1[n - 1] + y0 * Vn1[n - 1]);
+    }
+
+    // --- Gradient ---
+    double ax = 0.0;
+    double ay = 0.0;
+    double az = 0.0;
+
+    for (int n = 0; n <= N; ++n)
+    {
+        const double* C   = C_.data() + index(n, 0);
+        const double* S   = S_.data() + index(n, 0);
+        const double* zf  = zFactor_.data() + index(n, 0);
+        const double* up  = upFactor_.data() + index(n, 0);
+        const double* dn  = downFactor_.data() + index(n, 0);
+        const double* V1  = V + index(n + 1, 0);
+        const double* W1  = W + index(n + 1, 0);
+
+        // Zonal term
+        ax -= C[0] * up[0] * V1[1];
+        ay -= C[0] * up[0] * W1[1];
+        az -= zf[0] * (C[0] * V1[0] + S[0] * W1[0]);
+
+        #pragma omp simd reduction(+:ax, ay, az)
+        for (int m = 1; m <= n; ++m)
+        {
+            ax += up[m] * (-C[m] * V1[m + 1] - S[m] * W1[m + 1]) + dn[m] * (C[m] * V1[m - 1] + S[m] * W1[m - 1]);
+            ay += up[m] * (-C[m] * W1[m + 1] + S[m] * V1[m + 1]) + dn[m] * (-C[m] * W1[m - 1] + S[m] * V1[m - 1]);
+            az += zf[m] * (-C[m] * V1[m] - S[m] * W1[m]);
+        }
+    }
+
+    const double scale = gm_ / (radius_ * radius_);
+    return {ax * scale, ay * scale, az * scale};
+}
+
+//******************************************************
+//************* PRIVATE ********************************
+//******************************************************
+void SphericalHarmonicGravityModel::loadShadr(const std::string& path, int maxDegree)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("SphericalHarmonicGravityModel: cannot open " + path);
+    }
+
+    // Header: reference radius [km], GM [km³/s²], GM uncertainty, degree, order, ...
+    std::string line;
+    std::vector<double> header;
+    while (header.size() < 4 && std::getline(file, line))
+    {
+        header = parseNumbers(line);
+    }
+    if (header.size() < 4)
+    {
+        throw std::runtime_error("SphericalHarmonicGravityModel: missing SHADR header in " + path);
+    }
+
+    radius_ = header[0] * 1.0e3;
+    gm_     = header[1] * 1.0e9;
+
+    const int fileDegree = static_cast<int>(header[3]);
+    degree_ = (maxDegree > 0) ? std::min(maxDegree, fileDegree) : fileDegree;
+    if (degree_ < 0 || radius_ <= 0.0 || gm_ <= 0.0)
+    {
+        throw std::runtime_error("SphericalHarmonicGravityModel: invalid SHADR header in " + path);
+    }
+
+    const std::size_t count = index(degree_ + 1, 0);
+    C_.assign(count, 0.0);
+    S_.assign(count, 0.0);
+    C_[0] = 1.0;    // Tables usually start at degree 1 or 2
+
+    // Records: n, m, C̄, S̄, σC, σS
+    while (std::getline(file, line))
+    {
+        const std::vector<double> record = parseNumbers(line);
+        if (record.size() < 4)
+            continue;
+
+        const int n = static_cast<int>(record[0]);
+        const int m = static_cast<int>(record[1]);
+        if (n < 0 || m < 0 || m > n || n > degree_)
+            continue;
+
+        C_[index(n, m)] = record[2];
+        S_[index(n, m)] = record[3];
+    }
+}
+
+void SphericalHarmonicGravityModel::precompute()
+{
+    const int N = degree_;
+
+    // --- Recursion factors up to degree N+1 ---
+    const std::size_t recursionSize = index(N + 2, 0);
+    alpha_.assign(recursionSize, 0.0);
+    beta_.assign(recursionSize, 0.0);
+    gamma_.assign(N + 2, 0.0);
+
+    for (int n = 1; n <= N + 1; ++n)
+    {
+        for (int m = 0; m < n; ++m)
+        {
+            const double nd = n;
+            const double md = m;
+            alpha_[index(n, m)] = std::sqrt((2 * nd + 1) * (2 * nd - 1) / ((nd - md) * (nd + md)));
+            if (n >= 2)
+            {
+                beta_[index(n, m)] = std::sqrt((2 * nd + 1) * (nd + md - 1) * (nd - md - 1) / ((2 * nd - 3) * (nd + md) * (nd - md)));
+            }
+        }
+        gamma_[n] = (n == 1) ? std::sqrt(3.0) : std::sqrt((2.0 * n + 1) / (2.0 * n));
+    }
+
+    // --- Gradient factors up to degree N ---
+    const std::size_t gradientSize = index(N + 1, 0);
+    zFactor_.assign(gradientSize, 0.0);
+    upFactor_.assign(gradientSize, 0.0);
+    downFactor_.assign(gradientSize, 0.0);
+
+    for (int n = 0; n <= N; ++n)
+    {
+        const double nd = n;
+        const double q  = (2 * nd + 1) / (2 * nd + 3);
+
+        for (int m = 0; m <= n; ++m)
+        {
+            const double md = m;
+            const std::size_t i = index(n, m);
+
+            zFactor_[i] = std::sqrt(q * (nd + md + 1) * (nd - md + 1));
+
+            if (m == 0)
+            {
+                upFactor_[i] = std::sqrt(0.5 * q * (nd + 2) * (nd + 1));
+            }
+            else
+            {
+                const double downNorm = (m == 1) ? 2.0 : 1.0;
+                upFactor_[i]   = 0.5 * std::sqrt(q * (nd + md + 2) * (nd + md + 1));
+                downFactor_[i] = 0.5 * std::sqrt(downNorm * q * (nd - md + 2) * (nd - md + 1));
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#include "Physics/thirdBodyPerturbation.h"
+
+#include <cmath>
+
+//******************************************************
+//************* PUBLIC *********************************
+//******************************************************
+void ThirdBodyPerturbation::addBody(const ChebyshevEphemeris& ephemeris)
+{
+    bodies_.push_back(ephemeris);
+}
+
+Vector3 ThirdBodyPerturbation::perturbingAcceleration(const Vector3& pos, double t) const
+{
+    Vector3 acc = {0.0, 0.0, 0.0};
+
+    for (const ChebyshevEphemeris& body : bodies_)
+    {
+        const Vector3 s = body.position(t + epochOffset_);
+        const Vector3 d = s - pos;
+
+        const double d2 = d.dot(d);
+        const double s2 = s.dot(s);
+
+        // Direct pull on the spacecraft minus pull on the moon
+        acc = acc + d * (body.gm() / (d2 * std::sqrt(d2)))
+                  - s * (body.gm() / (s2 * std::sqrt(s2)));
+    }
+
+    return acc;
+}
@@ -0,0 +1,62 @@
+#include "Sensory_Perception/inertialSensor.h"
+
+#include <cmath>
+
+InertialSensor::InertialSensor(const InertialNoise& noise, std::uint64_t seed, std::uint64_t stream)
+    : spec_(noise), noise_(seed, stream)
+{
+    bias_ = gaussianVector() * spec_.biasSigma;
+}
+
+void InertialSensor::sample(const SensorTruth& truth, double dt)
+{
+    if (dt <= 0.0)
+    {
+        return;
+    }
+
+    bias_ += gaussianVector() * (spec_.biasRandomWalk * std::sqrt(dt));
+    reading_ = truthValue(truth) + bias_ + gaussianVector() * (spec_.noiseDensity / std::sqrt(dt));
+    valid_ = true;
+}
+
+const Vector3& InertialSensor::getReading() const
+{
+    return reading_;
+}
+
+const Vector3& InertialSensor::getBias() const
+{
+    return bias_;
+}
+
+bool InertialSensor::isValid() const
+{
+    return valid_;
+}
+
+SensorCheckpoint InertialSensor::captureCheckpoint() const
+{
+    SensorCheckpoint checkpoint;
+    checkpoint.noise   = noise_.state();
+    checkpoint.bias    = bias_;
+    checkpoint.reading = reading_;
+    checkpoint.valid   = valid_;
+    return checkpoint;
+}
+
+void InertialSensor::restoreCheckpoint(const SensorCheckpoint& checkpoint)
+{
+    noise_.setState(checkpoint.noise);
+    bias_    = checkpoint.bias;
+    reading_ = checkpoint.reading;
+    valid_   = checkpoint.valid;
+}
+
+Vector3 InertialSensor::gaussianVector()
+{
+    const double x = noise_.gaussian();
+    const double y = noise_.gaussian();
+    const double z = noise_.gaussian();
+    return {x, y, z};
+}
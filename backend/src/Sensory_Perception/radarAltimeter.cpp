@@ -0,0 +1,65 @@
+#include "Sensory_Perception/radarAltimeter.h"
+
+#include <algorithm>
+#include <cmath>
+
+RadarAltimeter::RadarAltimeter(std::uint64_t seed, std::uint64_t stream,
+                               double maxRange, double maxTilt,
+                               double rangeNoise, double rangeNoiseScale)
+    : noise_(seed, stream),
+      maxRange_(maxRange),
+      minCosTilt_(std::cos(maxTilt)),
+      rangeNoise_(rangeNoise),
+      rangeNoiseScale_(rangeNoiseScale)
+{}
+
+void RadarAltimeter::sample(const SensorTruth& truth, double /*dt*/)
+{
+    // Beam along body -z, B_down is the local vertical in the body frame
+    const double cosTilt = -truth.B_down.z;
+
+    // Draw unconditionally so the stream position does not depend on the geometry
+    const double n = noise_.gaussian();
+
+    if (cosTilt < minCosTilt_ || truth.altitude < 0.0)
+    {
+        valid_ = false;
+        return;
+    }
+
+    const double range = truth.altitude / cosTilt;
+    if (range > maxRange_)
+    {
+        valid_ = false;
+        return;
+    }
+
+    range_ = std::max(0.0, range + (rangeNoise_ + rangeNoiseScale_ * range) * n);
+    valid_ = true;
+}
+
+double RadarAltimeter::getRange() const
+{
+    return range_;
+}
+
+bool RadarAltimeter::isValid() const
+{
+    return valid_;
+}
+
+SensorCheckpoint RadarAltimeter::captureCheckpoint() const
+{
+    SensorCheckpoint checkpoint;
+    checkpoint.noise   = noise_.state();
+    checkpoint.reading = {range_, 0.0, 0.0};
+    checkpoint.valid   = valid_;
+    return checkpoint;
+}
+
+void RadarAltimeter::restoreCheckpoint(const SensorCheckpoint& checkpoint)
+{
+    noise_.setState(checkpoint.noise);
+    range_ = checkpoint.reading.x;
+    valid_ = checkpoint.valid;
+}
@@ -23,3 +23,26 @@ double SensorModel::computeGLoad(const Vector3& totalAcceleration, const Vector3
 
     return gLoad;
 }
+
+void SensorModel::sample(const SensorTruth& truth, double /*dt*/)
+{
+    gLoad_ = truth.B_specificForce.norm() / configData.earthGravity;
+}
+
+double SensorModel::getGLoad() const
+{
+    return gLoad_;
+}
+
+SensorCheckpoint SensorModel::captureCheckpoint() const
+{
+    SensorCheckpoint checkpoint;
+    checkpoint.reading  = {gLoad_, 0.0, 0.0};
+    checkpoint.valid    = true;
+    return checkpoint;
+}
+
+void SensorModel::restoreCheckpoint(const SensorCheckpoint& checkpoint)
+{
+    gLoad_ = checkpoint.reading.x;
+}
@@ -0,0 +1,149 @@
+#include "Sensory_Perception/sensorSuite.h"
+#include "spacecraft.h"
+
+#include <cmath>
+
+namespace
+{
+    /// [s] Slack for accumulated rounding, e.g. ten steps of 0.005 s sum to just below 0.05 s
+    constexpr double PERIOD_TOLERANCE = 1e-9;
+
+    /**
+     * @brief Advances a sample clock and reports whether a sample is due
+     *
+     * Keeps the overshoot past the period, so the sample rate is exact on average
+     * and does not drift in phase when the step does not divide the period.
+     */
+    bool sampleDue(double& elapsed, double dt, double period)
+    {
+        elapsed += dt;
+        if (elapsed + PERIOD_TOLERANCE < period)
+        {
+            return false;
+        }
+
+        elapsed -= period;
+        if (elapsed + PERIOD_TOLERANCE >= period)
+        {
+            // Step longer than the period: one sample, no backlog
+            elapsed = std::fmod(elapsed, period);
+        }
+        return true;
+    }
+
+    std::uint64_t streamId(std::size_t landerId, std::uint64_t channel)
+    {
+        return static_cast<std::uint64_t>(landerId) * SensorSuite::STREAMS_PER_LANDER + channel;
+    }
+}
+
+SensorSuite::SensorSuite(std::uint64_t seed, std::size_t landerId)
+    : accelerometer_(seed, streamId(landerId, AccelerometerChannel)),
+      gyroscope_(seed, streamId(landerId, GyroscopeChannel)),
+      radarAltimeter_(seed, streamId(landerId, RadarChannel)),
+      velocimeter_(seed, streamId(landerId, VelocimeterChannel))
+{}
+
+void SensorSuite::sample(const spacecraft& craft, double dt)
+{
+    sample(truthOf(craft), dt);
+}
+
+void SensorSuite::sample(const SensorTruth& truth, double dt)
+{
+    readings_.imuUpdated         = false;
+    readings_.radarUpdated       = false;
+    readings_.velocimeterUpdated = false;
+
+    if (dt <= 0.0)
+    {
+        return;
+    }
+
+    // --- IMU, every step ---
+    accelerometer_.sample(truth, dt);
+    gyroscope_.sample(truth, dt);
+    readings_.B_specificForce   = accelerometer_.getReading();
+    readings_.B_angularVelocity = gyroscope_.getReading();
+    readings_.imuUpdated        = true;
+
+    // --- Radar altimeter ---
+    if (sampleDue(radarElapsed_, dt, RADAR_PERIOD))
+    {
+        radarAltimeter_.sample(truth, RADAR_PERIOD);
+        readings_.radarRange   = radarAltimeter_.getRange();
+        readings_.radarUpdated = radarAltimeter_.isValid();
+    }
+
+    // --- Velocimeter ---
+    if (sampleDue(velocimeterElapsed_, dt, VELOCIMETER_PERIOD))
+    {
+        velocimeter_.sample(truth, VELOCIMETER_PERIOD);
+        readings_.B_velocity         = velocimeter_.getReading();
+        readings_.velocimeterUpdated = velocimeter_.isValid();
+    }
+}
+
+const SensorReadings& SensorSuite::readings() const
+{
+    return readings_;
+}
+
+const Accelerometer& SensorSuite::accelerometer() const
+{
+    return accelerometer_;
+}
+
+const Gyroscope& SensorSuite::gyroscope() const
+{
+    return gyroscope_;
+}
+
+const RadarAltimeter& SensorSuite::radarAltimeter() const
+{
+    return radarAltimeter_;
+}
+
+const Velocimeter& SensorSuite::velocimeter() const
+{
+    return velocimeter_;
+}
+
+SensorSuiteCheckpoint SensorSuite::captureCheckpoint() const
+{
+    SensorSuiteCheckpoint checkpoint;
+    checkpoint.accelerometer      = accelerometer_.captureCheckpoint();
+    checkpoint.gyroscope          = gyroscope_.captureCheckpoint();
+    checkpoint.radarAltimeter     = radarAltimeter_.captureCheckpoint();
+    checkpoint.velocimeter        = velocimeter_.captureCheckpoint();
+    checkpoint.radarElapsed       = radarElapsed_;
+    checkpoint.velocimeterElapsed = velocimeterElapsed_;
+    checkpoint.readings           = readings_;
+    return checkpoint;
+}
+
+void SensorSuite::restoreCheckpoint(const SensorSuiteCheckpoint& checkpoint)
+{
+    accelerometer_.restoreCheckpoint(checkpoint.accelerometer);
+    gyroscope_.restoreCheckpoint(checkpoint.gyroscope);
+    radarAltimeter_.restoreCheckpoint(checkpoint.radarAltimeter);
+    velocimeter_.restoreCheckpoint(checkpoint.velocimeter);
+    radarElapsed_       = checkpoint.radarElapsed;
+    velocimeterElapsed_ = checkpoint.velocimeterElapsed;
+    readings_           = checkpoint.readings;
+}
+
+SensorTruth SensorSuite::truthOf(const spacecraft& craft)
+{
+    const Quaternion orientation = craft.getOrientation();
+    const Vector3 I_position     = craft.getPosition();
+
+    SensorTruth truth;
+    truth.time              = craft.getTime();
+    truth.B_specificForce   = craft.getSpecificForce();
+    truth.B_angularVelocity = craft.getAngularVelocity();
+    truth.B_velocity        = orientation.rotateInverse(craft.getVelocity());
+    truth.B_down            = orientation.rotateInverse(-I_position.normalized());
+    truth.altitude          = craft.getAltitude();
+    return truth;
+}
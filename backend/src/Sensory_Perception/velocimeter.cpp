@@ -0,0 +1,53 @@
+#include "Sensory_Perception/velocimeter.h"
+
+Velocimeter::Velocimeter(std::uint64_t seed, std::uint64_t stream,
+                         double maxAltitude, double velocityNoise, double velocityNoiseScale)
+    : noise_(seed, stream),
+      maxAltitude_(maxAltitude),
+      velocityNoise_(velocityNoise),
+      velocityNoiseScale_(velocityNoiseScale)
+{}
+
+void Velocimeter::sample(const SensorTruth& truth, double /*dt*/)
+{
+    // Draw unconditionally so the stream position does not depend on the altitude
+    const double nx = noise_.gaussian();
+    const double ny = noise_.gaussian();
+    const double nz = noise_.gaussian();
+
+    if (truth.altitude > maxAltitude_)
+    {
+        valid_ = false;
+        return;
+    }
+
+    const double sigma = velocityNoise_ + velocityNoiseScale_ * truth.B_velocity.norm();
+    reading_ = truth.B_velocity + Vector3{nx, ny, nz} * sigma;
+    valid_ = true;
+}
+
+const Vector3& Velocimeter::getReading() const
+{
+    return reading_;
+}
+
+bool Velocimeter::isValid() const
+{
+    return valid_;
+}
+
+SensorCheckpoint Velocimeter::captureCheckpoint() const
+{
+    SensorCheckpoint checkpoint;
+    checkpoint.noise   = noise_.state();
+    checkpoint.reading = reading_;
+    checkpoint.valid   = valid_;
+    return checkpoint;
+}
+
+void Velocimeter::restoreCheckpoint(const SensorCheckpoint& checkpoint)
+{
+    noise_.setState(checkpoint.noise);
+    reading_ = checkpoint.reading;
+    valid_   = checkpoint.valid;
+}
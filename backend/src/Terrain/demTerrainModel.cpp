@@ -0,0 +1,136 @@
+#include "Terrain/demTerrainModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+constexpr double TWO_PI     = 2.0 * 3.14159265358979323846;
+}
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+DemTerrainModel::DemTerrainModel(const DemDescriptor& descriptor, double referenceRadius, std::size_t cacheTiles, double lodRatio)
+    : descriptor_(descriptor),
+    referenceRadius_(referenceRadius),
+    lodRatio_(lodRatio),
+    cache_(cacheTiles)
+{
+    if (descriptor_.columns < 2 || descriptor_.rows < 2)
+    {
+        throw std::runtime_error("DemTerrainModel: grid needs at least 2x2 samples");
+    }
+    if (descriptor_.headerBytes % sizeof(float) != 0)
+    {
+        throw std::runtime_error("DemTerrainModel: header size must be a multiple of 4 bytes");
+    }
+    if (descriptor_.maxLatitude <= descriptor_.minLatitude || descriptor_.maxLongitude <= descriptor_.minLongitude)
+    {
+        throw std::runtime_error("DemTerrainModel: invalid coverage bounds");
+    }
+
+    file_ = MappedFile(descriptor_.path);
+
+    const std::size_t sampleBytes = static_cast<std::size_t>(descriptor_.columns) * descriptor_.rows * sizeof(float);
+    if (file_.size() < descriptor_.headerBytes + sampleBytes)
+    {
+        throw std::runtime_error("DemTerrainModel: " + descriptor_.path + " is smaller than the described grid");
+    }
+    samples_ = reinterpret_cast<const float*>(file_.data() + descriptor_.headerBytes);
+
+    minLatitude_    = descriptor_.minLatitude * DEG_TO_RAD;
+    maxLatitude_    = descriptor_.maxLatitude * DEG_TO_RAD;
+    minLongitude_   = descriptor_.minLongitude * DEG_TO_RAD;
+    columnsPerRad_  = (descriptor_.columns - 1) / ((descriptor_.maxLongitude - descriptor_.minLongitude) * DEG_TO_RAD);
+    rowsPerRad_     = (descriptor_.rows - 1) / (maxLatitude_ - minLatitude_);
+    sampleSpacing_  = referenceRadius_ / rowsPerRad_;
+
+    // Add levels until the whole grid fits into one tile
+    const int cells = std::max(descriptor_.columns, descriptor_.rows) - 1;
+    levels_ = 1;
+    while ((cells >> (levels_ - 1)) > TILE_SIZE)
+    {
+        ++levels_;
+    }
+}
+
+double DemTerrainModel::heightAt(const Vector3& pos) const
+{
+    const double r = pos.norm();
+    if (r <= 0.0)
+        return 0.0;
+
+    const double latitude = std::asin(pos.z / r);
+    double longitude = std::atan2(pos.y, pos.x);
+    if (longitude < minLongitude_)
+        longitude += TWO_PI;
+
+    // Fractional grid coordinates at level 0
+    const double u = (longitude - minLongitude_) * columnsPerRad_;
+    const double v = (maxLatitude_ - latitude) * rowsPerRad_;
+
+    if (u < 0.0 || v < 0.0 || u > descriptor_.columns - 1 || v > descriptor_.rows - 1)
+        return 0.0;
+
+    const int level = levelForAltitude(r - referenceRadius_);
+    const double scale = 1.0 / static_cast<double>(1 << level);
+    const double lu = u * scale;
+    const double lv = v * scale;
+
+    TerrainTileKey key;
+    key.level = static_cast<std::uint32_t>(level);
+    key.x = static_cast<std::int32_t>(lu / TILE_SIZE);
+    key.y = static_cast<std::int32_t>(lv / TILE_SIZE);
+
+    const TerrainTile* tile = cache_.findOrBuildHinted(key, [&] { return buildTile(key); });
+    return tile->sample(lu - key.x * TILE_SIZE, lv - key.y * TILE_SIZE);
+}
+
+int DemTerrainModel::levelCount() const
+{
+    return levels_;
+}
+
+int DemTerrainModel::levelForAltitude(double altitude) const
+{
+    const double ratio = altitude / (lodRatio_ * sampleSpacing_);
+    if (!(ratio >= 2.0))
+        return 0;
+
+    return std::min(std::ilogb(ratio), levels_ - 1);
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+TerrainTileCache::TilePtr DemTerrainModel::buildTile(const TerrainTileKey& key) const
+{
+    auto tile = std::make_shared<TerrainTile>();
+    tile->key   = key;
+    tile->size  = TILE_SIZE;
+    tile->heights.resize(static_cast<std::size_t>(TILE_SIZE + 1) * (TILE_SIZE + 1));
+
+    const std::int64_t stride   = std::int64_t{1} << key.level;
+    const std::int64_t lastCol  = descriptor_.columns - 1;
+    const std::int64_t lastRow  = descriptor_.rows - 1;
+    const std::int64_t col0     = static_cast<std::int64_t>(key.x) * TILE_SIZE;
+    const std::int64_t row0     = static_cast<std::int64_t>(key.y) * TILE_SIZE;
+
+    float* out = tile->heights.data();
+    for (int j = 0; j <= TILE_SIZE; ++j)
+    {
+        const std::int64_t row = std::min((row0 + j) * stride, lastRow);
+        const float* src = samples_ + row * descriptor_.columns;
+
+        for (int i = 0; i <= TILE_SIZE; ++i)
+        {
+            const std::int64_t col = std::min((col0 + i) * stride, lastCol);
+            *out++ = src[col];
+        }
+    }
+
+    return tile;
+}
@@ -0,0 +1,129 @@
+#include "Terrain/mappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("MappedFile: cannot open " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        throw std::runtime_error("MappedFile: empty or unreadable file " + path);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        throw std::runtime_error("MappedFile: cannot map " + path);
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("MappedFile: cannot map " + path);
+    }
+
+    fileHandle_     = file;
+    mappingHandle_  = mapping;
+    data_           = static_cast<const unsigned char*>(view);
+    size_           = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("MappedFile: cannot open " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("MappedFile: empty or unreadable file " + path);
+    }
+
+    void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps its own reference
+
+    if (view == MAP_FAILED)
+    {
+        throw std::runtime_error("MappedFile: cannot map " + path);
+    }
+
+    // Height queries jump around the file
+    ::madvise(view, static_cast<std::size_t>(st.st_size), MADV_RANDOM);
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<std::size_t>(st.st_size);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        fileHandle_     = std::exchange(other.fileHandle_, nullptr);
+        mappingHandle_  = std::exchange(other.mappingHandle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+void MappedFile::close()
+{
+    if (!data_)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mappingHandle_));
+    CloseHandle(static_cast<HANDLE>(fileHandle_));
+    fileHandle_     = nullptr;
+    mappingHandle_  = nullptr;
+#else
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+
+    data_ = nullptr;
+    size_ = 0;
+}
@@ -0,0 +1,404 @@
+#include "Terrain/proceduralTerrainModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+/// Upper bound of queued tile requests; the oldest requests are dropped first
+constexpr std::size_t MAX_QUEUED_TILES = 64;
+
+/// Number of ground track points checked by prefetch
+constexpr int PREFETCH_POINTS = 8;
+
+/**
+ * @brief Cube face frames: face normal and the two in-plane axes
+ */
+struct FaceFrame
+{
+    Vector3 normal;
+    Vector3 axisU;
+    Vector3 axisV;
+};
+
+const FaceFrame FACES[6] = {
+    {{ 1, 0, 0}, { 0, 1, 0}, {0, 0, 1}},
+    {{-1, 0, 0}, { 0,-1, 0}, {0, 0, 1}},
+    {{ 0, 1, 0}, {-1, 0, 0}, {0, 0, 1}},
+    {{ 0,-1, 0}, { 1, 0, 0}, {0, 0, 1}},
+    {{ 0, 0, 1}, { 1, 0, 0}, {0, 1, 0}},
+    {{ 0, 0,-1}, { 1, 0, 0}, {0,-1, 0}},
+};
+
+std::uint64_t mix(std::uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+std::uint64_t hashCell(std::uint64_t seed, std::int64_t x, std::int64_t y, std::int64_t z)
+{
+    const std::uint64_t h = static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ULL
+                          + static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4FULL
+                          + static_cast<std::uint64_t>(z) * 0x165667B19E3779F9ULL;
+    return mix(seed ^ mix(h));
+}
+
+/// @return Uniform value in [0, 1)
+double unitFromHash(std::uint64_t h)
+{
+    return static_cast<double>(h >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double fade(double t)
+{
+    return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);
+}
+
+double smoothstep(double t)
+{
+    return t * t * (3.0 - 2.0 * t);
+}
+
+/// @return Value noise in [-1, 1] on the unit lattice
+double valueNoise(const Vector3& q, std::uint64_t seed)
+{
+    const double fx = std::floor(q.x);
+    const double fy = std::floor(q.y);
+    const double fz = std::floor(q.z);
+    const auto ix = static_cast<std::int64_t>(fx);
+    const auto iy = static_cast<std::int64_t>(fy);
+    const auto iz = static_cast<std::int64_t>(fz);
+    const double wx = fade(q.x - fx);
+    const double wy = fade(q.y - fy);
+    const double wz = fade(q.z - fz);
+
+    auto corner = [&](int dx, int dy, int dz) {
+        return unitFromHash(hashCell(seed, ix + dx, iy + dy, iz + dz)) * 2.0 - 1.0;
+    };
+
+    const double x00 = corner(0, 0, 0) + (corner(1, 0, 0) - corner(0, 0, 0)) * wx;
+    const double x10 = corner(0, 1, 0) + (corner(1, 1, 0) - corner(0, 1, 0)) * wx;
+    const double x01 = corner(0, 0, 1) + (corner(1, 0, 1) - corner(0, 0, 1)) * wx;
+    const double x11 = corner(0, 1, 1) + (corner(1, 1, 1) - corner(0, 1, 1)) * wx;
+    const double y0  = x00 + (x10 - x00) * wy;
+    const double y1  = x01 + (x11 - x01) * wy;
+    return y0 + (y1 - y0) * wz;
+}
+}
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+ProceduralTerrainModel::ProceduralTerrainModel(const ProceduralTerrainConfig& config, double referenceRadius)
+    : config_(config),
+    referenceRadius_(referenceRadius),
+    faceStep_(config.cellSize / referenceRadius),
+    cache_(config.cacheTiles)
+{
+    const int threads = std::max(config_.generatorThreads, 1);
+    generators_.reserve(threads);
+    for (int i = 0; i < threads; ++i)
+    {
+        generators_.emplace_back(&ProceduralTerrainModel::generatorLoop, this);
+    }
+}
+
+ProceduralTerrainModel::~ProceduralTerrainModel()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stop_ = true;
+        queue_.clear();
+    }
+    queueCv_.notify_all();
+
+    for (auto& generator : generators_)
+    {
+        generator.join();
+    }
+}
+
+double ProceduralTerrainModel::heightAt(const Vector3& pos) const
+{
+    const double r = pos.norm();
+    if (r <= 0.0)
+        return 0.0;
+
+    const GridPoint g = locate(pos, levelForAltitude(r - referenceRadius_));
+
+    if (const TerrainTile* tile = cache_.findHinted(g.key))
+        return tile->sample(g.u, g.v);
+
+    // Tile not generated yet: evaluate the four surrounding samples directly
+    request(g.key);
+
+    const int i = std::min(static_cast<int>(g.u), TILE_SIZE - 1);
+    const int j = std::min(static_cast<int>(g.v), TILE_SIZE - 1);
+    const std::int64_t gi = static_cast<std::int64_t>(g.key.x) * TILE_SIZE + i;
+    const std::int64_t gj = static_cast<std::int64_t>(g.key.y) * TILE_SIZE + j;
+    const int level = static_cast<int>(g.key.level);
+
+    return TerrainTile::bilinear(gridSample(g.key.face, level, gi, gj),
+                                 gridSample(g.key.face, level, gi + 1, gj),
+                                 gridSample(g.key.face, level, gi, gj + 1),
+                                 gridSample(g.key.face, level, gi + 1, gj + 1),
+                                 g.u - i, g.v - j);
+}
+
+void ProceduralTerrainModel::prefetch(const Vector3& pos, const Vector3& vel) const
+{
+    const double r = pos.norm();
+    if (r <= 0.0)
+        return;
+
+    const int level = levelForAltitude(r - referenceRadius_);
+
+    TerrainTileKey last;
+    for (int k = 0; k <= PREFETCH_POINTS; ++k)
+    {
+        const double t = config_.prefetchHorizon * k / PREFETCH_POINTS;
+        const TerrainTileKey key = locate(pos + vel * t, level).key;
+
+        if (k > 0 && key == last)
+            continue;
+
+        request(key);
+        last = key;
+    }
+}
+
+double ProceduralTerrainModel::surfaceHeight(const Vector3& dir) const
+{
+    const Vector3 p = dir * referenceRadius_;
+
+    return fractalNoise(p)
+         + craterLayer(p, config_.largeCraterCell, 0x51ED2701ULL)
+         + craterLayer(p, config_.smallCraterCell, 0xA3C59AC3ULL)
+         + boulderLayer(p);
+}
+
+std::size_t ProceduralTerrainModel::pendingTiles() const
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    return queued_.size();
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+ProceduralTerrainModel::GridPoint ProceduralTerrainModel::locate(const Vector3& pos, int level) const
+{
+    const double ax = std::abs(pos.x);
+    const double ay = std::abs(pos.y);
+    const double az = std::abs(pos.z);
+
+    std::uint32_t face;
+    if (ax >= ay && ax >= az)
+        face = pos.x >= 0.0 ? 0 : 1;
+    else if (ay >= az)
+        face = pos.y >= 0.0 ? 2 : 3;
+    else
+        face = pos.z >= 0.0 ? 4 : 5;
+
+    const FaceFrame& frame = FACES[face];
+    const double d = pos.dot(frame.normal);
+    const double u = pos.dot(frame.axisU) / d;
+    const double v = pos.dot(frame.axisV) / d;
+
+    const double step = faceStep_ * static_cast<double>(std::int64_t{1} << level);
+    const double gu = (u + 1.0) / step;
+    const double gv = (v + 1.0) / step;
+
+    GridPoint g;
+    g.key.face  = face;
+    g.key.level = static_cast<std::uint32_t>(level);
+    g.key.x     = static_cast<std::int32_t>(gu / TILE_SIZE);
+    g.key.y     = static_cast<std::int32_t>(gv / TILE_SIZE);
+    g.u         = gu - static_cast<double>(g.key.x) * TILE_SIZE;
+    g.v         = gv - static_cast<double>(g.key.y) * TILE_SIZE;
+    return g;
+}
+
+int ProceduralTerrainModel::levelForAltitude(double altitude) const
+{
+    const double ratio = altitude / (config_.lodRatio * config_.cellSize);
+    if (!(ratio >= 2.0))
+        return 0;
+
+    return std::min(std::ilogb(ratio), config_.maxLevel);
+}
+
+float ProceduralTerrainModel::gridSample(std::uint32_t face, int level, std::int64_t gi, std::int64_t gj) const
+{
+    const double step = faceStep_ * static_cast<double>(std::int64_t{1} << level);
+    const double u = -1.0 + static_cast<double>(gi) * step;
+    const double v = -1.0 + static_cast<double>(gj) * step;
+
+    const FaceFrame& frame = FACES[face];
+    const Vector3 dir = (frame.normal + frame.axisU * u + frame.axisV * v).normalized();
+    return static_cast<float>(surfaceHeight(dir));
+}
+
+TerrainTileCache::TilePtr ProceduralTerrainModel::buildTile(const TerrainTileKey& key) const
+{
+    auto tile = std::make_shared<TerrainTile>();
+    tile->key   = key;
+    tile->size  = TILE_SIZE;
+    tile->heights.resize(static_cast<std::size_t>(TILE_SIZE + 1) * (TILE_SIZE + 1));
+
+    const std::int64_t col0 = static_cast<std::int64_t>(key.x) * TILE_SIZE;
+    const std::int64_t row0 = static_cast<std::int64_t>(key.y) * TILE_SIZE;
+    const int level = static_cast<int>(key.level);
+
+    float* out = tile->heights.data();
+    for (int j = 0; j <= TILE_SIZE; ++j)
+    {
+        for (int i = 0; i <= TILE_SIZE; ++i)
+        {
+            *out++ = gridSample(key.face, level, col0 + i, row0 + j);
+        }
+    }
+
+    return tile;
+}
+
+void ProceduralTerrainModel::request(const TerrainTileKey& key) const
+{
+    if (cache_.contains(key))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        if (stop_ || !queued_.insert(key).second)
+            return;
+
+        queue_.push_back(key);
+        if (queue_.size() > MAX_QUEUED_TILES)
+        {
+            queued_.erase(queue_.front());
+            queue_.pop_front();
+        }
+    }
+    queueCv_.notify_one();
+}
+
+void ProceduralTerrainModel::generatorLoop()
+{
+    while (true)
+    {
+        TerrainTileKey key;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+
+            if (stop_)
+                return;
+
+            // Newest requests are closest to the lander
+            key = queue_.back();
+            queue_.pop_back();
+        }
+
+        if (!cache_.contains(key))
+        {
+            cache_.insert(buildTile(key));
+        }
+
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        queued_.erase(key);
+    }
+}
+
+double ProceduralTerrainModel::craterLayer(const Vector3& p, double cell, std::uint64_t salt) const
+{
+    const std::uint64_t seed = config_.seed ^ salt;
+    const auto cx = static_cast<std::int64_t>(std::floor(p.x / cell));
+    const auto cy = static_cast<std::int64_t>(std::floor(p.y / cell));
+    const auto cz = static_cast<std::int64_t>(std::floor(p.z / cell));
+
+    double height = 0.0;
+    for (int dz = -1; dz <= 1; ++dz)
+    for (int dy = -1; dy <= 1; ++dy)
+    for (int dx = -1; dx <= 1; ++dx)
+    {
+        const std::uint64_t h = hashCell(seed, cx + dx, cy + dy, cz + dz);
+        if (unitFromHash(h) >= config_.craterProbability)
+            continue;
+
+        // Jittered center, projected onto the reference sphere
+        Vector3 center = { (cx + dx + unitFromHash(mix(h + 1))) * cell,
+                           (cy + dy + unitFromHash(mix(h + 2))) * cell,
+                           (cz + dz + unitFromHash(mix(h + 3))) * cell };
+        center = center.normalized() * referenceRadius_;
+
+        const double radius = cell * (0.1 + 0.3 * unitFromHash(mix(h + 4)));
+        const double x = (p - center).norm() / radius;
+        if (x >= 1.5)
+            continue;
+
+        const double depth = 0.2 * radius;
+        const double rim   = 0.08 * radius;
+
+        if (x < 1.0)
+            height += depth * (x * x - 1.0) + rim;             // Bowl
+        else
+            height += rim * (1.0 - smoothstep((x - 1.0) / 0.5)); // Rim falloff
+    }
+
+    return height;
+}
+
+double ProceduralTerrainModel::boulderLayer(const Vector3& p) const
+{
+    const double cell = config_.boulderCell;
+    const std::uint64_t seed = config_.seed ^ 0xB0D1DE55ULL;
+    const auto cx = static_cast<std::int64_t>(std::floor(p.x / cell));
+    const auto cy = static_cast<std::int64_t>(std::floor(p.y / cell));
+    const auto cz = static_cast<std::int64_t>(std::floor(p.z / cell));
+
+    double height = 0.0;
+    for (int dz = -1; dz <= 1; ++dz)
+    for (int dy = -1; dy <= 1; ++dy)
+    for (int dx = -1; dx <= 1; ++dx)
+    {
+        const std::uint64_t h = hashCell(seed, cx + dx, cy + dy, cz + dz);
+        if (unitFromHash(h) >= config_.boulderProbability)
+            continue;
+
+        Vector3 center = { (cx + dx + unitFromHash(mix(h + 1))) * cell,
+                           (cy + dy + unitFromHash(mix(h + 2))) * cell,
+                           (cz + dz + unitFromHash(mix(h + 3))) * cell };
+        center = center.normalized() * referenceRadius_;
+
+        const double radius = config_.maxBoulderRadius * (0.3 + 0.7 * unitFromHash(mix(h + 4)));
+        const double x = (p - center).norm() / radius;
+        if (x >= 1.0)
+            continue;
+
+        // Partly buried sphere
+        height = std::max(height, 0.6 * radius * std::sqrt(1.0 - x * x));
+    }
+
+    return height;
+}
+
+double ProceduralTerrainModel::fractalNoise(const Vector3& p) const
+{
+    double amplitude  = config_.noiseAmplitude;
+    double wavelength = config_.noiseWavelength;
+    double height     = 0.0;
+
+    for (int octave = 0; octave < config_.noiseOctaves; ++octave)
+    {
+        height     += amplitude * valueNoise(p / wavelength, config_.seed + octave);
+        amplitude  *= 0.5;
+        wavelength *= 0.5;
+    }
+
+    return height;
+}
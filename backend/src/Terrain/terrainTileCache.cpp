@@ -0,0 +1,101 @@
+#include "Terrain/terrainTileCache.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+std::atomic<std::uint64_t> nextCacheId{1};
+}
+
+thread_local TerrainTileCache::Hint TerrainTileCache::hint_;
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+TerrainTileCache::TerrainTileCache(std::size_t capacity)
+    : id_(nextCacheId.fetch_add(1)),
+    capacity_(std::max<std::size_t>(capacity, 1))
+{
+    index_.reserve(capacity_);
+}
+
+TerrainTileCache::TilePtr TerrainTileCache::find(const TerrainTileKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(key);
+    if (it == index_.end())
+        return nullptr;
+
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return *it->second;
+}
+
+const TerrainTile* TerrainTileCache::findHinted(const TerrainTileKey& key)
+{
+    if (hint_.owner == id_ && hint_.tile->key == key)
+        return hint_.tile.get();
+
+    TilePtr tile = find(key);
+    if (!tile)
+        return nullptr;
+
+    return setHint(std::move(tile));
+}
+
+TerrainTileCache::TilePtr TerrainTileCache::insert(TilePtr tile)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(tile->key);
+    if (it != index_.end())
+    {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return *it->second;
+    }
+
+    if (lru_.size() >= capacity_)
+    {
+        index_.erase(lru_.back()->key);
+        lru_.pop_back();
+    }
+
+    lru_.push_front(std::move(tile));
+    index_.emplace(lru_.front()->key, lru_.begin());
+    return lru_.front();
+}
+
+bool TerrainTileCache::contains(const TerrainTileKey& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.count(key) != 0;
+}
+
+void TerrainTileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    lru_.clear();
+}
+
+std::size_t TerrainTileCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+std::size_t TerrainTileCache::capacity() const
+{
+    return capacity_;
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+const TerrainTile* TerrainTileCache::setHint(TilePtr tile)
+{
+    hint_.owner = id_;
+    hint_.tile  = std::move(tile);
+    return hint_.tile.get();
+}
\ No newline at end of file
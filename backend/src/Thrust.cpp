@@ -1,4 +1,5 @@
 #include "Thrust.h"
+#include <algorithm>
 #include <iostream>
 // ---Private-------------------------------------
 
@@ -37,7 +38,7 @@ void Thrust::setTargetThrustInNewton(EngineType engine, const double &tMainEngin
         }
         else if (engine == EngineType::RCS)
         {
-            // To be done...
+            setTargetRCSWrench(tRCSThrust, {0.0, 0.0, 0.0});
         }
 }
 
@@ -61,12 +62,37 @@ void Thrust::setTargetThrustInPercentage(EngineType engine, const double &tMainE
     }
     else if (engine == EngineType::RCS)
     {
-        // To be done...
-        std::cout << "RCS Thrust: \n"
-                  << "x: " << tRCSThrust.x << "\n"
-                  << "y: " << tRCSThrust.y << "\n"
-                  << "z: " << tRCSThrust.z << "\n"
-                  << std::endl;
+        if (!rcsAllocationValid_)
+        {
+            refreshRCSAllocation();
+        }
+
+        // Fraction of the authority along each signed body axis
+        auto axisForce = [](double command, double positive, double negative)
+        {
+            return command >= 0.0 ? command * positive : command * negative;
+        };
+
+        const Vector3 force = {axisForce(tRCSThrust.x, rcsAuthorityPositive_.x, rcsAuthorityNegative_.x),
+                               axisForce(tRCSThrust.y, rcsAuthorityPositive_.y, rcsAuthorityNegative_.y),
+                               axisForce(tRCSThrust.z, rcsAuthorityPositive_.z, rcsAuthorityNegative_.z)};
+
+        setTargetRCSWrench(force, {0.0, 0.0, 0.0});
+    }
+}
+
+void Thrust::setTargetRCSWrench(const Vector3 &B_force, const Vector3 &B_torque)
+{
+    if (!rcsAllocationValid_)
+    {
+        refreshRCSAllocation();
+    }
+
+    const std::vector<double>& onLevels = rcsAllocator_.allocate(B_force, B_torque);
+
+    for (size_t i = 0; i < rcsModels_.size(); ++i)
+    {
+        models_[rcsModels_[i]]->setTargetInPercentage(onLevels[i]);
     }
 }
 
@@ -78,8 +104,11 @@ void Thrust::shutDownAllEngines() const
     }
 }
 
-void Thrust::initializeEngines(std::vector<EngineConfig> &engineConfigs, const std::vector<FuelTank> &tanks)
+void Thrust::initializeEngines(std::vector<EngineConfig> &engineConfigs, const std::vector<FuelTank> &tanks, const Vector3 &B_centerOfMass)
 {
+    B_centerOfMass_ = B_centerOfMass;
+    rcsAllocationValid_ = false;
+
     // -----------------------------------------
     // Initialize tanks
     // -----------------------------------------
@@ -101,12 +130,12 @@ void Thrust::initializeEngines(std::vector<EngineConfig> &engineConfigs, const s
         else if (cfg_.type == "translation")
         {
             std::cout << "[Thrust]-initializeEngines- Configured RCS translational engine" << std::endl;
-            std::cout << "[Thrust]-initializeEngines- RCS Model not included yet" << std::endl;
-            addModel(std::make_unique<basicMainEngineModel>(cfg_, state));
+            addModel(std::make_unique<basicRCSThrusterModel>(cfg_, state));
         }
         else if (cfg_.type == "rotation")
         {
             std::cout << "[Thrust]-initializeEngines- Configured RCS rotational engine" << std::endl;
+            addModel(std::make_unique<basicRCSThrusterModel>(cfg_, state));
         }
         else
         {
@@ -120,11 +149,13 @@ void Thrust::initializeEngines(std::vector<EngineConfig> &engineConfigs, const s
 void Thrust::activateEngine(const size_t &engineNr)
 {
     models_[engineNr]->setEnginePowerSwitch(true);
+    rcsAllocationValid_ = false;
 }
 
 void Thrust::deactivateEngine(const size_t &engineNr)
 {
     models_[engineNr]->setEnginePowerSwitch(false);
+    rcsAllocationValid_ = false;
 }
 
 void Thrust::turnOffAllEngines()
@@ -133,6 +164,7 @@ void Thrust::turnOffAllEngines()
     {
         model->setEnginePowerSwitch(false);
     }
+    rcsAllocationValid_ = false;
 }
 void Thrust::updateThrust(double dt)
 {
@@ -317,6 +349,24 @@ Vector3 Thrust::getDirectionOfThrust(EngineType engine, int engineID) const
     return dir;
 }
 
+Vector3 Thrust::getCurrentTorque(const Vector3 &B_centerOfMass) const
+{
+    Vector3 total{0.0, 0.0, 0.0};
+
+    for (const auto& model : models_)
+    {
+        double thrust = model->getCurrentThrust();
+        if (thrust == 0.0) continue;
+
+        // Reaction force acts against the exhaust direction
+        Vector3 force = -(model->getDirectionOfThrust() * thrust);
+        Vector3 arm   = model->getEnginePosition() - B_centerOfMass;
+
+        total += arm.cross(force);
+    }
+    return total;
+}
+
 double Thrust::getFuelConsumption(EngineType engine) const
 {
     double sum = 0.0;
@@ -347,10 +397,6 @@ double Thrust::getFuelConsumption(EngineType engine) const
             }
         }
     }
-    for (const auto& model : models_)
-    {
-        sum += model->getFuelConsumption();
-    }
 
     return sum;
 }
@@ -360,6 +406,90 @@ const std::vector<FuelTank>& Thrust::getFuelTanks() const
     return tanks_;
 }
 
+// --- Checkpoint ---------------------------------------------------
+
+void Thrust::writeCheckpoint(CheckpointWriter &writer) const
+{
+    writer.write(static_cast<std::uint32_t>(models_.size()));
+    writer.write(static_cast<std::uint32_t>(tanks_.size()));
+
+    for (const auto& model : models_)
+    {
+        writer.write(model->captureCheckpoint());
+    }
+
+    for (const auto& tank : tanks_)
+    {
+        writer.write(tank.mass);
+    }
+}
+
+void Thrust::readCheckpoint(CheckpointReader &reader, ThrustCheckpoint &out) const
+{
+    std::uint32_t engineCount = 0;
+    std::uint32_t tankCount = 0;
+    reader.read(engineCount);
+    reader.read(tankCount);
+
+    if (engineCount != models_.size() || tankCount != tanks_.size())
+    {
+        throw std::runtime_error("[Thrust]-readCheckpoint- Engine or tank layout does not match checkpoint");
+    }
+
+    out.engines.resize(engineCount);
+    reader.read(out.engines.data(), out.engines.size());
+
+    out.tankMasses.resize(tankCount);
+    reader.read(out.tankMasses.data(), out.tankMasses.size());
+}
+
+void Thrust::restoreCheckpoint(const ThrustCheckpoint &checkpoint)
+{
+    for (std::size_t i = 0; i < models_.size(); ++i)
+    {
+        models_[i]->restoreCheckpoint(checkpoint.engines[i]);
+    }
+    rcsAllocationValid_ = false;
+
+    for (std::size_t i = 0; i < tanks_.size(); ++i)
+    {
+        tanks_[i].mass = checkpoint.tankMasses[i];
+    }
+}
+
+void Thrust::refreshRCSAllocation()
+{
+    std::vector<Vector3> forces;
+    std::vector<Vector3> torques;
+    rcsModels_.clear();
+    rcsAuthorityPositive_ = {0.0, 0.0, 0.0};
+    rcsAuthorityNegative_ = {0.0, 0.0, 0.0};
+
+    for (size_t i = 0; i < models_.size(); ++i)
+    {
+        const auto& model = models_[i];
+        const std::string type = model->getEngineType();
+        if ((type != "translation" && type != "rotation") || !model->isEngineActivated())
+        {
+            continue;
+        }
+
+        // Reaction force at full on-level acts against the exhaust direction
+        const Vector3 force = -(model->getDirectionOfThrust() * model->getMaxThrust());
+        const Vector3 arm   = model->getEnginePosition() - B_centerOfMass_;
+
+        rcsModels_.push_back(i);
+        forces.push_back(force);
+        torques.push_back(arm.cross(force));
+
+        rcsAuthorityPositive_ += {std::max(force.x, 0.0), std::max(force.y, 0.0), std::max(force.z, 0.0)};
+        rcsAuthorityNegative_ += {std::max(-force.x, 0.0), std::max(-force.y, 0.0), std::max(-force.z, 0.0)};
+    }
+
+    rcsAllocator_.configure(forces, torques);
+    rcsAllocationValid_ = true;
+}
+
 void Thrust::addModel(std::unique_ptr<IThrustModel> model)
 {
     models_.push_back(std::move(model));
@@ -1,4 +1,7 @@
 #include "Thrust/BasicMainEngineModel.h"
+#include "dual.h"
+
+#include <cmath>
 
 // -------------------------------------------------------------------------
 // Public class methods
@@ -25,7 +28,7 @@ void basicMainEngineModel::updateThrust(const double &dt)
 {
     if(engineConfig_.timeConstant != 0)
     {
-        ME_thrustState_.current += (1 - exp(-dt / engineConfig_.timeConstant)) * (ME_thrustState_.target - ME_thrustState_.current);
+        ME_thrustState_.current = calcThrustResponse(ME_thrustState_.current, ME_thrustState_.target, dt, engineConfig_.timeConstant);
 
         fuelstate_.consumptionRate = calcMassFlow(ME_thrustState_.current, engineConfig_.Isp, 9.81);
 
@@ -64,6 +67,11 @@ int basicMainEngineModel::getEngineID() const
     return engineConfig_.id;
 }
 
+bool basicMainEngineModel::isEngineActivated() const
+{
+    return engineConfig_.engineActivated;
+}
+
 std::string basicMainEngineModel::getEngineType() const
 {
     return engineConfig_.type;
@@ -99,11 +107,58 @@ Vector3 basicMainEngineModel::getDirectionOfThrust() const
     return engineConfig_.direction;
 }
 
+Vector3 basicMainEngineModel::getEnginePosition() const
+{
+    return engineConfig_.position;
+}
+
 double basicMainEngineModel::getMaxThrust() const
 {
     return engineConfig_.maxThrust;
 }
 
+// -------------------------------------------------------------------------
+// Checkpoint
+// -------------------------------------------------------------------------
+EngineCheckpoint basicMainEngineModel::captureCheckpoint() const
+{
+    EngineCheckpoint checkpoint;
+    checkpoint.thrustState      = ME_thrustState_;
+    checkpoint.fuelState        = fuelstate_;
+    checkpoint.engineActivated  = engineConfig_.engineActivated;
+    return checkpoint;
+}
+
+void basicMainEngineModel::restoreCheckpoint(const EngineCheckpoint &checkpoint)
+{
+    ME_thrustState_                 = checkpoint.thrustState;
+    fuelstate_                      = checkpoint.fuelState;
+    engineConfig_.engineActivated   = checkpoint.engineActivated;
+}
+
+// -------------------------------------------------------------------------
+// Engine dynamics
+// -------------------------------------------------------------------------
+template<typename T>
+T basicMainEngineModel::calcThrustResponse(const T &current, const T &target, const T &dt, const T &timeConstant)
+{
+    using std::exp;
+
+    return current + (1.0 - exp(-dt / timeConstant)) * (target - current);
+}
+
+template<typename T>
+T basicMainEngineModel::calcMassFlow(const T &currenThrust, const T &Isp, const T &earthGravity)
+{
+    return currenThrust / (Isp * earthGravity);
+}
+
+template<typename T>
+T basicMainEngineModel::calcRemainingFuel(const T &fuelMass, const T &massFlowFuel, const T &dt)
+{
+    return fuelMass - (massFlowFuel * dt);
+}
+
 // -------------------------------------------------------------------------
 // Private setter functions
 // -------------------------------------------------------------------------
@@ -118,12 +173,13 @@ void basicMainEngineModel::setDefaultValues()
 // -------------------------------------------------------------------------
 double basicMainEngineModel::calcFuelReduction(const double &fuelMass, const double &massFlowFuel, const double &dt)
 {
-    double newFuelMass = fuelMass - (massFlowFuel * dt);
-
-    return newFuelMass;
+    return calcRemainingFuel(fuelMass, massFlowFuel, dt);
 }
 
-double basicMainEngineModel::calcMassFlow(const double &currenThrust, const double &Isp, const double &earthGravity)
-{
-    return currenThrust / (Isp * earthGravity);
-}
+// explicit instantiations
+template double basicMainEngineModel::calcThrustResponse<double>(const double&, const double&, const double&, const double&);
+template double basicMainEngineModel::calcMassFlow<double>(const double&, const double&, const double&);
+template double basicMainEngineModel::calcRemainingFuel<double>(const double&, const double&, const double&);
+template SensitivityScalar basicMainEngineModel::calcThrustResponse<SensitivityScalar>(const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&);
+template SensitivityScalar basicMainEngineModel::calcMassFlow<SensitivityScalar>(const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&);
+template SensitivityScalar basicMainEngineModel::calcRemainingFuel<SensitivityScalar>(const SensitivityScalar&, const SensitivityScalar&, const SensitivityScalar&);
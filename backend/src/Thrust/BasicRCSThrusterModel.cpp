@@ -0,0 +1,139 @@
+#include "Thrust/BasicRCSThrusterModel.h"
+#include "Thrust/BasicMainEngineModel.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// -------------------------------------------------------------------------
+// Public class methods
+// -------------------------------------------------------------------------
+basicRCSThrusterModel::basicRCSThrusterModel(const EngineConfig& eConfig, FuelState fState)
+    : engineConfig_(EngineConfig::Create(eConfig.engineActivated,
+                                         eConfig.id,
+                                         eConfig.name,
+                                         eConfig.type,
+                                         eConfig.tankID,
+                                         eConfig.Isp,
+                                         eConfig.timeConstant,
+                                         eConfig.responseRate,
+                                         eConfig.maxThrust,
+                                         eConfig.direction,
+                                         eConfig.position)
+                    ),
+    fuelstate_(fState)
+{
+    engineConfig_.engineActivated = true;
+}
+
+void basicRCSThrusterModel::updateThrust(const double &dt)
+{
+    if (engineConfig_.timeConstant == 0)
+    {
+        throw std::runtime_error("basicRCSThrusterModel: time constant tau is zero");
+    }
+
+    thrustState_.current = basicMainEngineModel::calcThrustResponse(thrustState_.current, thrustState_.target, dt, engineConfig_.timeConstant);
+
+    fuelstate_.consumptionRate = basicMainEngineModel::calcMassFlow(thrustState_.current, engineConfig_.Isp, 9.81);
+    fuelstate_.massCurrent = calcFuelReduction(fuelstate_.massCurrent, fuelstate_.consumptionRate, dt);
+}
+
+// -------------------------------------------------------------------------
+// Public setter override functions
+// -------------------------------------------------------------------------
+void basicRCSThrusterModel::setEnginePowerSwitch(bool activateEngine)
+{
+    engineConfig_.engineActivated = activateEngine;
+}
+
+void basicRCSThrusterModel::setTarget(const double &tThrust)
+{
+    thrustState_.target = engineConfig_.engineActivated ? std::clamp(tThrust, 0.0, engineConfig_.maxThrust) : 0.0;
+}
+
+void basicRCSThrusterModel::setTargetInPercentage(const double &tThrustInPercentage)
+{
+    thrustState_.target = engineConfig_.engineActivated ? std::clamp(tThrustInPercentage, 0.0, 1.0) * engineConfig_.maxThrust : 0.0;
+}
+
+// -------------------------------------------------------------------------
+// Public getter override functions
+// -------------------------------------------------------------------------
+int basicRCSThrusterModel::getEngineID() const
+{
+    return engineConfig_.id;
+}
+
+bool basicRCSThrusterModel::isEngineActivated() const
+{
+    return engineConfig_.engineActivated;
+}
+
+std::string basicRCSThrusterModel::getEngineType() const
+{
+    return engineConfig_.type;
+}
+
+double basicRCSThrusterModel::getTargetThrust() const
+{
+    return thrustState_.target;
+}
+
+double basicRCSThrusterModel::getCurrentThrust() const
+{
+    return thrustState_.current;
+}
+
+double basicRCSThrusterModel::getFuelConsumption() const
+{
+    return fuelstate_.consumptionRate;
+}
+
+double basicRCSThrusterModel::getCurrentFuelMass() const
+{
+    return fuelstate_.massCurrent;
+}
+
+double basicRCSThrusterModel::getTankID() const
+{
+    return engineConfig_.tankID;
+}
+
+Vector3 basicRCSThrusterModel::getDirectionOfThrust() const
+{
+    return engineConfig_.direction;
+}
+
+Vector3 basicRCSThrusterModel::getEnginePosition() const
+{
+    return engineConfig_.position;
+}
+
+double basicRCSThrusterModel::calcFuelReduction(const double &fuelMass, const double &massFlowFuel, const double &dt)
+{
+    return basicMainEngineModel::calcRemainingFuel(fuelMass, massFlowFuel, dt);
+}
+
+double basicRCSThrusterModel::getMaxThrust() const
+{
+    return engineConfig_.maxThrust;
+}
+
+// -------------------------------------------------------------------------
+// Checkpoint
+// -------------------------------------------------------------------------
+EngineCheckpoint basicRCSThrusterModel::captureCheckpoint() const
+{
+    EngineCheckpoint checkpoint;
+    checkpoint.thrustState      = thrustState_;
+    checkpoint.fuelState        = fuelstate_;
+    checkpoint.engineActivated  = engineConfig_.engineActivated;
+    return checkpoint;
+}
+
+void basicRCSThrusterModel::restoreCheckpoint(const EngineCheckpoint &checkpoint)
+{
+    thrustState_                    = checkpoint.thrustState;
+    fuelstate_                      = checkpoint.fuelState;
+    engineConfig_.engineActivated   = checkpoint.engineActivated;
+}
@@ -0,0 +1,261 @@
+#include "Thrust/controlAllocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+ControlAllocator::ControlAllocator(double forceWeight, double torqueWeight)
+{
+    if (!(forceWeight > 0.0) || !(torqueWeight > 0.0))
+    {
+        throw std::runtime_error("ControlAllocator: weights must be positive");
+    }
+
+    const double f = std::sqrt(forceWeight);
+    const double t = std::sqrt(torqueWeight);
+    weight_.data = {f, f, f, t, t, t};
+}
+
+void ControlAllocator::configure(const std::vector<Vector3>& B_forces, const std::vector<Vector3>& B_torques)
+{
+    if (B_forces.size() != B_torques.size())
+    {
+        throw std::runtime_error("ControlAllocator: force and torque count differ");
+    }
+
+    n_ = B_forces.size();
+    B_.assign(WRENCH * n_, 0.0);
+    u_.assign(n_, 0.0);
+    step_.assign(n_, 0.0);
+    bound_.assign(n_, Bound::Free);
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        double* b = &B_[WRENCH * i];
+        b[0] = weight_[0] * B_forces[i].x;
+        b[1] = weight_[1] * B_forces[i].y;
+        b[2] = weight_[2] * B_forces[i].z;
+        b[3] = weight_[3] * B_torques[i].x;
+        b[4] = weight_[4] * B_torques[i].y;
+        b[5] = weight_[5] * B_torques[i].z;
+
+        double norm2 = 0.0;
+        for (std::size_t k = 0; k < WRENCH; ++k)
+        {
+            norm2 += b[k] * b[k];
+        }
+        scale = std::max(scale, norm2);
+    }
+
+    // Fewer than six independent thrusters leave B̃B̃ᵀ singular
+    if (scale == 0.0)
+    {
+        scale = 1.0;
+    }
+    lambda_     = REGULARIZATION * scale;
+    tolerance_  = TOLERANCE * scale;
+
+    // All thrusters free
+    Matrix6 gram = Matrix6::identity() * lambda_;
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        addOuterProduct(gram, &B_[WRENCH * i]);
+    }
+    factor_ = gram.cholesky();
+}
+
+const std::vector<double>& ControlAllocator::allocate(const Vector3& B_force, const Vector3& B_torque)
+{
+    if (n_ == 0)
+    {
+        return u_;
+    }
+
+    Wrench target;
+    target.data = {weight_[0] * B_force.x,  weight_[1] * B_force.y,  weight_[2] * B_force.z,
+                   weight_[3] * B_torque.x, weight_[4] * B_torque.y, weight_[5] * B_torque.z};
+
+    auto onLevel = [&](std::size_t i, const Wrench& y)
+    {
+        const double* b = &B_[WRENCH * i];
+        double sum = 0.0;
+        for (std::size_t k = 0; k < WRENCH; ++k)
+        {
+            sum += b[k] * y[k];
+        }
+        return sum;
+    };
+
+    // --- Unconstrained minimizer from the cached factor ---
+    const Wrench y = factor_.choleskySolve(target);
+    bool feasible = true;
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        const double level = onLevel(i, y);
+        if (level < 0.0)
+        {
+            u_[i] = 0.0;
+            bound_[i] = Bound::Lower;
+            feasible = false;
+        }
+        else if (level > 1.0)
+        {
+            u_[i] = 1.0;
+            bound_[i] = Bound::Upper;
+            feasible = false;
+        }
+        else
+        {
+            u_[i] = level;
+            bound_[i] = Bound::Free;
+        }
+    }
+    if (feasible)
+    {
+        return u_;
+    }
+
+    // --- Primal active-set method on the box [0, 1]ⁿ ---
+    for (int iteration = 0; iteration < MAX_ITERATIONS; ++iteration)
+    {
+        // Wrench left for the free thrusters
+        Wrench r = target;
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            if (bound_[i] == Bound::Free) continue;
+            const double* b = &B_[WRENCH * i];
+            for (std::size_t k = 0; k < WRENCH; ++k)
+            {
+                r[k] -= b[k] * u_[i];
+            }
+        }
+
+        const Wrench yFree = solveFree(r);
+
+        // Longest step toward the free minimizer that stays inside the box
+        double alpha = 1.0;
+        std::size_t blocking = n_;
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            if (bound_[i] != Bound::Free) continue;
+            step_[i] = onLevel(i, yFree);
+
+            if (step_[i] < 0.0 && u_[i] - alpha * (u_[i] - step_[i]) < 0.0)
+            {
+                alpha = u_[i] / (u_[i] - step_[i]);
+                blocking = i;
+            }
+            else if (step_[i] > 1.0 && u_[i] + alpha * (step_[i] - u_[i]) > 1.0)
+            {
+                alpha = (1.0 - u_[i]) / (step_[i] - u_[i]);
+                blocking = i;
+            }
+        }
+
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            if (bound_[i] == Bound::Free)
+            {
+                u_[i] = std::clamp(u_[i] + alpha * (step_[i] - u_[i]), 0.0, 1.0);
+            }
+        }
+
+        if (blocking < n_)
+        {
+            bound_[blocking] = step_[blocking] < 0.0 ? Bound::Lower : Bound::Upper;
+            u_[blocking]     = step_[blocking] < 0.0 ? 0.0 : 1.0;
+            continue;
+        }
+
+        // Free thrusters are optimal; check the multipliers of the bound ones
+        Wrench residual = -target;
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            const double* b = &B_[WRENCH * i];
+            for (std::size_t k = 0; k < WRENCH; ++k)
+            {
+                residual[k] += b[k] * u_[i];
+            }
+        }
+
+        double worst = tolerance_;
+        std::size_t release = n_;
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            if (bound_[i] == Bound::Free) continue;
+
+            // Gradient of the objective, positive if a larger on-level costs more
+            const double gradient = onLevel(i, residual) + lambda_ * u_[i];
+            const double violation = (bound_[i] == Bound::Lower) ? -gradient : gradient;
+            if (violation > worst)
+            {
+                worst = violation;
+                release = i;
+            }
+        }
+
+        if (release == n_)
+        {
+            break;
+        }
+        bound_[release] = Bound::Free;
+    }
+    return u_;
+}
+
+Vector3 ControlAllocator::achievedForce() const
+{
+    Vector3 force{0.0, 0.0, 0.0};
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        const double* b = &B_[WRENCH * i];
+        force += Vector3{b[0], b[1], b[2]} * u_[i];
+    }
+    return {force.x / weight_[0], force.y / weight_[1], force.z / weight_[2]};
+}
+
+Vector3 ControlAllocator::achievedTorque() const
+{
+    Vector3 torque{0.0, 0.0, 0.0};
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        const double* b = &B_[WRENCH * i];
+        torque += Vector3{b[3], b[4], b[5]} * u_[i];
+    }
+    return {torque.x / weight_[3], torque.y / weight_[4], torque.z / weight_[5]};
+}
+
+std::size_t ControlAllocator::size() const
+{
+    return n_;
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+ControlAllocator::Wrench ControlAllocator::solveFree(const Wrench& r) const
+{
+    Matrix6 gram = Matrix6::identity() * lambda_;
+    for (std::size_t i = 0; i < n_; ++i)
+    {
+        if (bound_[i] != Bound::Free) continue;
+        addOuterProduct(gram, &B_[WRENCH * i]);
+    }
+    return gram.cholesky().choleskySolve(r);
+}
+
+void ControlAllocator::addOuterProduct(Matrix6& m, const double* b)
+{
+    // Matrix::cholesky reads the lower triangle only
+    for (std::size_t row = 0; row < WRENCH; ++row)
+    {
+        for (std::size_t col = 0; col <= row; ++col)
+        {
+            m(row, col) += b[row] * b[col];
+        }
+    }
+}
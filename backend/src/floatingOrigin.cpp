@@ -0,0 +1,63 @@
+#include "floatingOrigin.h"
+
+#include <cmath>
+
+namespace
+{
+    /// [m] Rebase beyond this local coordinate
+    constexpr double REBASE_DISTANCE = FloatingOrigin::GRID;
+}
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+Vector3 FloatingOrigin::reset(const Vector3& absolute)
+{
+    origin_ = {snap(absolute.x), snap(absolute.y), snap(absolute.z)};
+    return toLocal(absolute);
+}
+
+bool FloatingOrigin::rebase(Vector3& local)
+{
+    if (std::abs(local.x) <= REBASE_DISTANCE &&
+        std::abs(local.y) <= REBASE_DISTANCE &&
+        std::abs(local.z) <= REBASE_DISTANCE)
+    {
+        return false;
+    }
+
+    // Whole grid steps: exact in double for both origin and local coordinates
+    const Vector3 shift = {snap(local.x), snap(local.y), snap(local.z)};
+
+    origin_ = origin_ + shift;
+    local   = local - shift;
+    return true;
+}
+
+Vector3 FloatingOrigin::toAbsolute(const Vector3& local) const
+{
+    return origin_ + local;
+}
+
+Vector3 FloatingOrigin::toLocal(const Vector3& absolute) const
+{
+    return absolute - origin_;
+}
+
+const Vector3& FloatingOrigin::origin() const
+{
+    return origin_;
+}
+
+void FloatingOrigin::setOrigin(const Vector3& origin)
+{
+    origin_ = origin;
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+double FloatingOrigin::snap(double value)
+{
+    return std::round(value / GRID) * GRID;
+}
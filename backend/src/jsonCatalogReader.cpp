@@ -0,0 +1,254 @@
+#include "jsonCatalogReader.h"
+#include "jsonConfigReader.h"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+// -------------------------------------------------------------------------
+// Counting input iterator
+// -------------------------------------------------------------------------
+// nlohmann's SAX events carry no source position. Wrapping the input iterator
+// lets the handler read how many bytes the lexer has pulled so far. Structural
+// tokens ('{', '}') are single characters and the lexer never reads past them
+// before emitting the event, so the byte count at start_object/end_object
+// pins the brace exactly.
+template<typename BaseIterator>
+class countingIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = char;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const char*;
+    using reference         = char;
+
+    countingIterator(BaseIterator it, std::size_t* counter) : it_(it), counter_(counter) {}
+
+    char operator*() const { return *it_; }
+
+    countingIterator& operator++()
+    {
+        ++it_;
+        ++(*counter_);
+        return *this;
+    }
+
+    countingIterator operator++(int)
+    {
+        countingIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    bool operator==(const countingIterator& other) const { return it_ == other.it_; }
+    bool operator!=(const countingIterator& other) const { return it_ != other.it_; }
+
+private:
+    BaseIterator it_;
+    std::size_t* counter_;
+};
+
+// -------------------------------------------------------------------------
+// SAX handler
+// -------------------------------------------------------------------------
+// Tracks nesting depth only. Entries are the objects directly inside the
+// "spacecraft" array of the root object; of their contents only the top-level
+// "name" string is kept.
+class catalogIndexHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    catalogIndexHandler(std::vector<CatalogEntry>& entries, const std::size_t* position)
+        : entries_(entries), position_(position) {}
+
+    bool null() override                                   { return value(); }
+    bool boolean(bool) override                            { return value(); }
+    bool number_integer(number_integer_t) override         { return value(); }
+    bool number_unsigned(number_unsigned_t) override       { return value(); }
+    bool number_float(number_float_t, const string_t&) override { return value(); }
+    bool binary(binary_t&) override                        { return value(); }
+
+    bool string(string_t& val) override
+    {
+        if (expectName_)
+            current_.name = val;
+        return value();
+    }
+
+    bool start_object(std::size_t) override
+    {
+        if (catalogDepth_ != 0 && depth_ == catalogDepth_)
+        {
+            current_ = CatalogEntry{};
+            current_.offset = *position_ - 1;
+        }
+        value();
+        ++depth_;
+        return true;
+    }
+
+    bool end_object() override
+    {
+        --depth_;
+        if (catalogDepth_ != 0 && depth_ == catalogDepth_)
+        {
+            current_.length = *position_ - current_.offset;
+            entries_.push_back(std::move(current_));
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override
+    {
+        const bool isCatalog = pendingCatalog_;
+        value();
+        ++depth_;
+        if (isCatalog)
+            catalogDepth_ = depth_;
+        return true;
+    }
+
+    bool end_array() override
+    {
+        if (depth_ == catalogDepth_)
+        {
+            // Everything after the catalog array is irrelevant; stop early.
+            catalogDepth_ = 0;
+            finished_ = true;
+            return false;
+        }
+        --depth_;
+        return true;
+    }
+
+    bool key(string_t& val) override
+    {
+        pendingCatalog_ = (depth_ == 1 && val == "spacecraft");
+        expectName_     = (catalogDepth_ != 0 && depth_ == catalogDepth_ + 1 && val == "name");
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&,
+                     const nlohmann::detail::exception& ex) override
+    {
+        throw std::runtime_error("Catalog parse error at byte " + std::to_string(position)
+                                 + ": " + ex.what());
+    }
+
+    bool finished() const { return finished_; }
+
+private:
+    // Any value consumes a pending key
+    bool value()
+    {
+        pendingCatalog_ = false;
+        expectName_ = false;
+        return true;
+    }
+
+    std::vector<CatalogEntry>& entries_;
+    const std::size_t* position_;
+    CatalogEntry current_;
+    std::size_t depth_ = 0;
+    std::size_t catalogDepth_ = 0;
+    bool pendingCatalog_ = false;
+    bool expectName_ = false;
+    bool finished_ = false;
+};
+
+} // namespace
+
+// -------------------------------------------------------------------------
+// Indexing
+// -------------------------------------------------------------------------
+
+template<typename Iterator>
+void jsonCatalogReader::buildIndex(Iterator first, Iterator last)
+{
+    entries_.clear();
+
+    std::size_t position = 0;
+    catalogIndexHandler handler(entries_, &position);
+
+    const bool ok = nlohmann::json::sax_parse(countingIterator<Iterator>(first, &position),
+                                              countingIterator<Iterator>(last, &position),
+                                              &handler);
+    if (!ok && !handler.finished())
+        throw std::runtime_error("Catalog indexing aborted");
+}
+
+void jsonCatalogReader::openFile(const std::string& filename)
+{
+    close();
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open catalog file: " + filename);
+    }
+
+    buildIndex(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    filename_ = filename;
+}
+
+void jsonCatalogReader::openBuffer(const char* data, std::size_t size)
+{
+    close();
+
+    buildIndex(data, data + size);
+    data_ = data;
+    dataSize_ = size;
+}
+
+void jsonCatalogReader::close()
+{
+    filename_.clear();
+    data_ = nullptr;
+    dataSize_ = 0;
+    entries_.clear();
+    entries_.shrink_to_fit();
+}
+
+// -------------------------------------------------------------------------
+// Access
+// -------------------------------------------------------------------------
+
+std::size_t jsonCatalogReader::size() const
+{
+    return entries_.size();
+}
+
+const CatalogEntry& jsonCatalogReader::entry(std::size_t index) const
+{
+    return entries_.at(index);
+}
+
+std::string jsonCatalogReader::rawEntry(std::size_t index) const
+{
+    const CatalogEntry& e = entries_.at(index);
+
+    if (data_ != nullptr)
+        return std::string(data_ + e.offset, e.length);
+
+    std::ifstream file(filename_, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open catalog file: " + filename_);
+    }
+
+    std::string text(e.length, '\0');
+    file.seekg(static_cast<std::streamoff>(e.offset));
+    file.read(text.data(), static_cast<std::streamsize>(e.length));
+    if (file.gcount() != static_cast<std::streamsize>(e.length)) {
+        throw std::runtime_error("Catalog file changed since indexing: " + filename_);
+    }
+    return text;
+}
+
+nlohmann::json jsonCatalogReader::entryJson(std::size_t index) const
+{
+    return nlohmann::json::parse(rawEntry(index));
+}
+
+customSpacecraft jsonCatalogReader::materialize(std::size_t index) const
+{
+    return jsonConfigReader::parseLander(entryJson(index));
+}
@@ -8,9 +8,16 @@ physics::~physics()
 }
 
 // public  ---------------------------------------------------------
-Vector3 physics::computeAcc(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust) const
+Vector3 physics::computeAcc(const Vector3& pos, const Vector3& vel, double mass, const Vector3& thrust, double t) const
 {
-    return model_->computeAcceleration(pos, vel, mass, thrust);
+    Vector3 acc = model_->computeAcceleration(pos, vel, mass, thrust);
+
+    for (const auto& perturbation : perturbations_)
+    {
+        acc = acc + perturbation->perturbingAcceleration(pos, t);
+    }
+
+    return acc;
 }
 
 Vector3 physics::computeVel(const Vector3& vel, const Vector3& acc, double dt) const
@@ -28,3 +35,20 @@ double physics::computeGLoad(const Vector3& totalAcceleration, const Vector3& gr
     return sensor_->computeGLoad(totalAcceleration, gravityAcceleration, isLanded);
 }
 
+void physics::setModel(std::shared_ptr<IPhysicsModel> model)
+{
+    model_ = model;
+}
+
+void physics::addPerturbation(std::shared_ptr<const IPerturbation> perturbation)
+{
+    perturbations_.push_back(perturbation);
+}
+
+std::optional<double> physics::keplerianParameter() const
+{
+    if (!perturbations_.empty())
+        return std::nullopt;
+
+    return model_->pointMassParameter();
+}
@@ -2,18 +2,116 @@
 #include "logger.h"
 #include "Automation/adaptiveDescentController.h"
 #include "Controller/pd_controller.h"
+#include "Physics/basicMoonGravityModel.h"
+#include "Integrators/keplerPropagator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 
 //***********************************************************
 //*************        Private                   ************
 //***********************************************************
-void simcontrol::buildSimulationEnvironment(double t)
+simcontrol::LanderInstance simcontrol::buildLander(const customSpacecraft& landerConfig, std::size_t landerId)
 {
     // Instance classes
-    landerSpacecraft    = std::make_unique<spacecraft>(landerMoon1);
-    inputArbiter_       = std::make_unique<InputArbiter>();
+    LanderInstance l;
+    l.config        = landerConfig;
+    l.craft         = std::make_unique<spacecraft>(landerConfig, environment_);
+    l.craft->setTerrainModel(terrain_);
+    for (const auto& perturbation : perturbations_)
+    {
+        l.craft->addPerturbation(perturbation);
+    }
+    l.arbiter       = std::make_unique<InputArbiter>();
+    l.autopilot     = std::make_unique<AdaptiveDescentController>(landerConfig.safeVelocity);
+    l.controller    = std::make_unique<PD_Controller>();
+    l.sensors       = std::make_unique<SensorSuite>(sensorSeed_, landerId);
+    l.navigation    = std::make_unique<NavigationFilter>(config_);
+    l.navigation->setTerrainModel(terrain_);
+    l.navigation->initialize(l.craft->getPosition(), l.craft->getVelocity(), landerConfig.emptyMass + l.craft->getTotalFuelMass());
+    l.telemetry     = l.craft->getFullSimulationData();
+    return l;
+}
+
+simcontrol::LanderInstance& simcontrol::lander(std::size_t id)
+{
+    if (id >= landers_.size())
+    {
+        throw std::out_of_range("simcontrol: invalid lander id " + std::to_string(id));
+    }
+    return landers_[id];
+}
+
+const simcontrol::LanderInstance& simcontrol::lander(std::size_t id) const
+{
+    if (id >= landers_.size())
+    {
+        throw std::out_of_range("simcontrol: invalid lander id " + std::to_string(id));
+    }
+    return landers_[id];
+}
+
+void simcontrol::stepLander(LanderInstance& l, std::uint64_t firstTick, std::uint64_t ticks)
+{
+    const double autopilotPeriod  = schedule_.period(SimTask::Autopilot);
+    const double propulsionPeriod = schedule_.period(SimTask::Propulsion);
+    const double physicsPeriod    = schedule_.period(SimTask::Physics);
+    const double sensorPeriod     = schedule_.period(SimTask::Sensors);
+
+    for (std::uint64_t tick = firstTick; tick < firstTick + ticks; ++tick)
+    {
+        // --- Autopilot Control ---
+        if (schedule_.isDue(SimTask::Autopilot, tick))
+        {
+            runAutopilot(l, l.craft->getSpacecraftState(), 0, autopilotPeriod);
+            l.craft->setConsoleText(l.autopilot->getDescentMode());
+        }
+
+        // --- Engines and tanks ---
+        if (schedule_.isDue(SimTask::Propulsion, tick))
+        {
+            l.craft->updatePropulsion(propulsionPeriod);
+        }
+
+        // --- Update spacecraft state (translation, velocity, etc.) ---
+        if (schedule_.isDue(SimTask::Physics, tick))
+        {
+            l.craft->updateDynamics(physicsPeriod);
+        }
+
+        // --- Measure the new state and update the estimate ---
+        if (schedule_.isDue(SimTask::Sensors, tick))
+        {
+            l.sensors->sample(*l.craft, sensorPeriod);
+
+            // Propellant actually burnt by the engine models, so the prediction follows lag and saturation
+            const double massFlow = l.craft->requestMainEngineLiveFuelConsumption() + l.craft->requestRCSLiveFuelConsumption();
+            l.navigation->process(l.sensors->readings(), l.craft->getOrientation(), massFlow, sensorPeriod);
+        }
+    }
+
+    // --- Prepare terrain along the ground track ---
+    if (terrain_)
+    {
+        terrain_->prefetch(l.craft->getPosition(), l.craft->getVelocity());
+    }
+
+    // --- Retrieve full simulation data ---
+    l.telemetry = l.craft->getFullSimulationData();
+}
+
+bool simcontrol::canFastForward(LanderInstance& l, double stopAltitude)
+{
+    if (l.arbiter->isAutomationActive())
+        return false;
+
+    const ControlCommand cmd = l.arbiter->chooseCommand();
+    if (cmd.mainEngine != 0.0f || cmd.translation.norm() != 0.0)
+        return false;
+
+    return l.craft->isCoasting() && l.craft->getAltitude() > stopAltitude;
 }
 
 customSpacecraft simcontrol::loadSpacecraftFromJsonString(const std::string& jsonString)
@@ -42,34 +140,36 @@ customSpacecraft simcontrol::loadSpacecraftFromJsonString(const std::string& jso
     return jsonConfigReader::parseLander(config);
 }
 
-void simcontrol::processCommands()
+void simcontrol::processCommands(LanderInstance& l)
 {
-    ControlCommand activeCommand = inputArbiter_->chooseCommand();
+    ControlCommand activeCommand = l.arbiter->chooseCommand();
 
-    setTargetMainEngineThrust(activeCommand.mainEngine);
-    setTargetRCSThrust(activeCommand.translation);
+    setTargetMainEngineThrust(l, activeCommand.mainEngine);
+    setTargetRCSThrust(l, activeCommand.translation);
 }
 
-void simcontrol::runAutopilot(const SpacecraftState& currentSpacecraftstate, const int &engineNr, const double& dt)
+void simcontrol::runAutopilot(LanderInstance& l, const SpacecraftState& currentSpacecraftstate, const int &engineNr, const double& dt)
 {
     // --- Autopilot Control ---
     if(currentSpacecraftstate == SpacecraftState::Operational)
     {
         // Autopilot is used for main engine of spacecraft with index number 0!
-        double autoThrust = autopilot_->setAutoThrustInNewton(controller_.get(), landerMoon1.engines_[0].maxThrust, landerSpacecraft->getVelocity().z, landerSpacecraft->getPosition().z - config_.radiusMoon, dt, landerMoon1.emptyMass + landerMoon1.fuelM, config_.moonGravity);
-        double autoThrustNormalized = autopilot_->normalizAutoThrust(autoThrust, landerMoon1.engines_[0].maxThrust);
+        // Guidance works on the navigation estimate, not on the true state
+        const NavigationEstimate nav = l.navigation->estimate();
+        double autoThrust = l.autopilot->setAutoThrustInNewton(l.controller.get(), l.config.engines_[0].maxThrust, nav.I_velocity.z, nav.altitude, dt, l.config.emptyMass + l.config.fuelM, config_.moonGravity);
+        double autoThrustNormalized = l.autopilot->normalizAutoThrust(autoThrust, l.config.engines_[0].maxThrust);
         ControlCommand autoCmd;
         autoCmd.mainEngine = autoThrustNormalized;
-        receiveCommandFromAutopilot(autoCmd);
-        processCommands();
+        l.arbiter->receiveAutoControlCommand(autoCmd);
+        processCommands(l);
     }
     else if (currentSpacecraftstate == SpacecraftState::Landed)
     {
         ControlCommand cmd;
         cmd.mainEngine          = 0.0;
         cmd.autopilotActive     = false;
-        receiveCommandFromAutopilot(cmd);
-        processCommands();
+        l.arbiter->receiveAutoControlCommand(cmd);
+        processCommands(l);
     }
 }
 
@@ -79,8 +179,8 @@ void simcontrol::runAutopilot(const SpacecraftState& currentSpacecraftstate, con
 
 simcontrol::simcontrol(double t0) : initialTime(t0)
 {
-    autopilot_  = std::make_unique<AdaptiveDescentController>(landerMoon1.safeVelocity);
-    controller_ = std::make_unique<PD_Controller>();
+    // One environment model for all landers
+    environment_ = std::make_shared<BasicMoonGravityModel>(config_);
 }
 
 simcontrol::~simcontrol()
@@ -90,9 +190,65 @@ simcontrol::~simcontrol()
 
 void simcontrol::initialize(const std::string& jsonConfigStr)
 {
-    landerMoon1 = loadSpacecraftFromJsonString(jsonConfigStr);
+    landers_.clear();
+    addLander(jsonConfigStr);
+}
+
+std::size_t simcontrol::addLander(const std::string& jsonConfigStr)
+{
+    landers_.push_back(buildLander(loadSpacecraftFromJsonString(jsonConfigStr), landers_.size()));
+    return landers_.size() - 1;
+}
+
+std::size_t simcontrol::landerCount() const
+{
+    return landers_.size();
+}
+
+void simcontrol::setTerrainModel(std::shared_ptr<const ITerrainModel> terrain)
+{
+    terrain_ = std::move(terrain);
 
-    buildSimulationEnvironment(initialTime);
+    for (LanderInstance& l : landers_)
+    {
+        l.craft->setTerrainModel(terrain_);
+        l.navigation->setTerrainModel(terrain_);
+    }
+}
+
+void simcontrol::setTaskRates(const TaskRates& rates)
+{
+    schedule_ = RateSchedule(rates);
+}
+
+const RateSchedule& simcontrol::getSchedule() const
+{
+    return schedule_;
+}
+
+void simcontrol::setSensorSeed(std::uint64_t seed)
+{
+    sensorSeed_ = seed;
+}
+
+void simcontrol::setEnvironmentModel(std::shared_ptr<IPhysicsModel> model)
+{
+    environment_ = std::move(model);
+
+    for (LanderInstance& l : landers_)
+    {
+        l.craft->setPhysicsModel(environment_);
+    }
+}
+
+void simcontrol::addPerturbation(std::shared_ptr<const IPerturbation> perturbation)
+{
+    perturbations_.push_back(perturbation);
+
+    for (LanderInstance& l : landers_)
+    {
+        l.craft->addPerturbation(perturbation);
+    }
 }
 
 void simcontrol::instanceLoggingAction()
@@ -110,15 +266,37 @@ simData simcontrol::runSimulation(const double dt)
     {
         logger.log("Simulation step started. dt = " + std::to_string(dt));
 
-        // --- Autopilot Control ---
-        runAutopilot(landerSpacecraft->getSpacecraftState(), 0, dt);
-        landerSpacecraft->setConsoleText(autopilot_->getDescentMode());
-
-        // --- Update spacecraft state (translation, velocity, etc.) ---
-        landerSpacecraft->updateStep(dt);   ///< Updates simulation steps
-
-        // --- Retrieve full simulation data ---
-        simdata_ = landerSpacecraft->getFullSimulationData();   ///< SimData struct can be requested from frontend
+        // --- Whole ticks of the requested span ---
+        const double tickPeriod = schedule_.tickPeriod();
+        pendingTime_ += dt;
+        const std::uint64_t ticks = static_cast<std::uint64_t>(std::floor(pendingTime_ / tickPeriod + 1e-9));
+        pendingTime_ = std::max(0.0, pendingTime_ - ticks * tickPeriod);
+
+        // --- Advance all landers ---
+        if (ticks > 0)
+        {
+            const std::uint64_t firstTick = tick_;
+
+            if (landers_.size() >= PARALLEL_LANDER_THRESHOLD)
+            {
+                if (!threadPool_)
+                {
+                    threadPool_ = std::make_unique<ThreadPool>();
+                }
+                threadPool_->parallelFor(landers_.size(), [&](std::size_t i) { stepLander(landers_[i], firstTick, ticks); });
+            }
+            else
+            {
+                for (LanderInstance& l : landers_)
+                {
+                    stepLander(l, firstTick, ticks);
+                }
+            }
+
+            tick_ += ticks;
+        }
+
+        simdata_ = lander(0).telemetry;   ///< SimData struct can be requested from frontend
 
         // --- Log results (adapt later to new state vector) ---
         /*
@@ -152,14 +330,150 @@ simData simcontrol::runSimulation(const double dt)
     return simdata_;
 }
 
+double simcontrol::fastForward(double maxDuration, double stopAltitude)
+{
+    if (landers_.empty() || maxDuration <= 0.0)
+        return 0.0;
+
+    // --- Next event over all landers; stop early enough to step onto the terrain ---
+    const double stop = terrain_ ? stopAltitude + FAST_FORWARD_TERRAIN_MARGIN : stopAltitude;
+
+    double duration = maxDuration;
+    for (LanderInstance& l : landers_)
+    {
+        if (!canFastForward(l, stop))
+            return 0.0;
+
+        duration = std::min(duration, timeToTerrainStop(l, stop));
+    }
+
+    if (duration <= 0.0)
+        return 0.0;
+
+    // --- Jump all landers ---
+    for (LanderInstance& l : landers_)
+    {
+        l.craft->coast(duration);
+        l.navigation->coast(config_.muMoon, duration);
+
+        if (terrain_)
+        {
+            terrain_->prefetch(l.craft->getPosition(), l.craft->getVelocity());
+        }
+
+        l.telemetry = l.craft->getFullSimulationData();
+    }
+
+    Logger::instance().log("Fast forward over " + std::to_string(duration) + " s coast");
+    return duration;
+}
+
+double simcontrol::timeToTerrainStop(const LanderInstance& l, double stopAltitude) const
+{
+    if (!terrain_)
+        return l.craft->timeToAltitude(stopAltitude);
+
+    // The stop radius only rises, so a few passes settle it on the highest arrival terrain
+    constexpr int MAX_PASSES = 4;
+
+    const KeplerPropagator propagator(config_.muMoon);
+    double height = terrain_->heightAt(l.craft->getPosition());
+
+    for (int pass = 0; pass < MAX_PASSES; ++pass)
+    {
+        const double time = l.craft->timeToAltitude(height + stopAltitude);
+        if (time == KeplerPropagator::NEVER)
+            return time;
+
+        Vector3 position = l.craft->getPosition();
+        Vector3 velocity = l.craft->getVelocity();
+        propagator.propagate(position, velocity, time);
+
+        const double arrivalHeight = terrain_->heightAt(position);
+        if (arrivalHeight <= height)
+            return time;
+
+        height = arrivalHeight;
+    }
+
+    return 0.0;
+}
+
+simData simcontrol::advanceSimulation(double duration, double maxStep)
+{
+    if (maxStep <= 0.0)
+    {
+        throw std::runtime_error("simcontrol: advanceSimulation requires a positive step");
+    }
+
+    // Remainders below this are rounding noise of the step sum
+    const double epsilon = 1e-9 * maxStep;
+    double remaining = duration;
+
+    while (remaining > epsilon)
+    {
+        // --- Coast phases are jumped in one step ---
+        remaining -= fastForward(remaining);
+        if (remaining <= epsilon)
+            break;
+
+        // --- Powered or perturbed flight is stepped ---
+        const double dt = std::min(maxStep, remaining);
+        runSimulation(dt);
+        remaining -= dt;
+    }
+
+    return lander(0).telemetry;
+}
+
+double simcontrol::allowedTimeWarp(double requested) const
+{
+    double warp = requested;
+
+    for (const LanderInstance& l : landers_)
+    {
+        const bool thrustActive = l.craft->requestTotalThrust().norm() >= spacecraft::IDLE_THRUST
+                               || l.craft->requestMainEngineTargetThrust().norm() > 0.0;
+
+        warp = std::min(warp, warpGovernor_.limit(requested, l.craft->getAltitude(), l.craft->getGload(), thrustActive));
+    }
+
+    return TimeWarpGovernor::snapToLevel(warp);
+}
+
+void simcontrol::setTimeWarpLimits(const TimeWarpLimits& limits)
+{
+    warpGovernor_.setLimits(limits);
+}
+
+simData simcontrol::getTelemetry(std::size_t landerId) const
+{
+    return lander(landerId).telemetry;
+}
+
+const SensorReadings& simcontrol::getSensorReadings(std::size_t landerId) const
+{
+    return lander(landerId).sensors->readings();
+}
+
+NavigationEstimate simcontrol::getNavigationEstimate(std::size_t landerId) const
+{
+    return lander(landerId).navigation->estimate();
+}
+
 void simcontrol::receiveCommandFromFrontEnd(const ControlCommand& userCmd)
 {
-    inputArbiter_->receiveUserControlCommand(userCmd);
+    receiveCommandFromFrontEnd(0, userCmd);
+}
+
+void simcontrol::receiveCommandFromFrontEnd(std::size_t landerId, const ControlCommand& userCmd)
+{
+    lander(landerId).arbiter->receiveUserControlCommand(userCmd);
 }
 
 void simcontrol::receiveCommandFromAutopilot(const ControlCommand& autoCmd)
 {
-    inputArbiter_->receiveAutoControlCommand(autoCmd);
+    lander(0).arbiter->receiveAutoControlCommand(autoCmd);
 }
 
 void simcontrol::setJsonConfigStr(const std::string &jsonConfigStr)
@@ -167,16 +481,16 @@ void simcontrol::setJsonConfigStr(const std::string &jsonConfigStr)
     jsonConfigString = jsonConfigStr;
 }
 
-void simcontrol::setTargetMainEngineThrust(const double& thrustPercent, const double& thrustInNewton)
+void simcontrol::setTargetMainEngineThrust(LanderInstance& l, const double& thrustPercent, const double& thrustInNewton)
 {
-    landerSpacecraft->setMainEngineThrust(thrustPercent);
+    l.craft->setMainEngineThrust(thrustPercent);
 }
 
 // Function is going to get obsolet when RCS model is introduced
 
-void simcontrol::setTargetRCSThrust(const Vector3 &ENU_translation)
+void simcontrol::setTargetRCSThrust(LanderInstance& l, const Vector3 &ENU_translation)
 {
-    landerSpacecraft->setTargetRCSThrust(ENU_translation);
+    l.craft->setTargetRCSThrust(ENU_translation);
 }
 
 void simcontrol::setResetBoolean()
@@ -188,3 +502,142 @@ void simcontrol::setAutoPilotCommand(const double &autoThrust)
 {
     receiveCommandFromAutopilot(cmd_);
 }
+
+double simcontrol::getSimulationTime() const
+{
+    return landers_.empty() ? initialTime : landers_.front().craft->getTime();
+}
+
+simData simcontrol::getSimulationData() const
+{
+    return lander(0).craft->getFullSimulationData();
+}
+
+// -------------------------------------------------------------------------
+// Checkpoint / Restore
+// -------------------------------------------------------------------------
+
+SimCheckpoint simcontrol::checkpoint() const
+{
+    SimCheckpoint blob;
+    checkpoint(blob);
+    return blob;
+}
+
+void simcontrol::checkpoint(SimCheckpoint& blob) const
+{
+    if (landers_.empty())
+    {
+        throw std::runtime_error("simcontrol::checkpoint called before initialize");
+    }
+
+    blob.clear();
+    CheckpointWriter writer(blob);
+
+    SimCheckpointHeader header;
+    header.magic    = SIM_CHECKPOINT_MAGIC;
+    header.version  = SIM_CHECKPOINT_VERSION;
+    writer.write(header);
+
+    writer.write(static_cast<std::uint32_t>(landers_.size()));
+    writer.write(tick_);
+    writer.write(pendingTime_);
+
+    for (const LanderInstance& l : landers_)
+    {
+        l.craft->writeCheckpoint(writer);
+        writer.write(l.arbiter->captureCheckpoint());
+        writer.write(l.controller->captureCheckpoint());
+        writer.write(l.autopilot->captureCheckpoint());
+        writer.write(l.sensors->captureCheckpoint());
+        writer.write(l.navigation->captureCheckpoint());
+    }
+
+    header.payloadSize = writer.position() - sizeof(SimCheckpointHeader);
+    writer.patch(0, header);
+}
+
+void simcontrol::restore(const SimCheckpoint& blob)
+{
+    restore(blob.data(), blob.size());
+}
+
+void simcontrol::restore(const std::uint8_t* data, std::size_t size)
+{
+    if (landers_.empty())
+    {
+        throw std::runtime_error("simcontrol::restore called before initialize");
+    }
+
+    CheckpointReader reader(data, size);
+
+    SimCheckpointHeader header;
+    reader.read(header);
+
+    if (header.magic != SIM_CHECKPOINT_MAGIC)
+    {
+        throw std::runtime_error("Invalid checkpoint: bad magic");
+    }
+    if (header.version != SIM_CHECKPOINT_VERSION)
+    {
+        throw std::runtime_error("Unsupported checkpoint version " + std::to_string(header.version));
+    }
+    if (header.payloadSize != reader.remaining())
+    {
+        throw std::runtime_error("Invalid checkpoint: payload size mismatch");
+    }
+
+    std::uint32_t landerCount = 0;
+    reader.read(landerCount);
+
+    if (landerCount != landers_.size())
+    {
+        throw std::runtime_error("Checkpoint lander count does not match simulation");
+    }
+
+    // --- Decode everything first, so a bad section leaves the simulation untouched ---
+    struct LanderSections
+    {
+        SpacecraftCheckpointSection craft;
+        ArbiterCheckpoint arbiter;
+        ControllerCheckpoint controller;
+        AutopilotCheckpoint autopilot;
+        SensorSuiteCheckpoint sensors;
+        NavigationFilter::Checkpoint navigation;
+    };
+
+    std::uint64_t tick = 0;
+    double pendingTime = 0.0;
+    reader.read(tick);
+    reader.read(pendingTime);
+
+    std::vector<LanderSections> sections(landers_.size());
+    for (std::size_t i = 0; i < landers_.size(); ++i)
+    {
+        LanderSections& s = sections[i];
+        landers_[i].craft->readCheckpoint(reader, s.craft);
+        reader.read(s.arbiter);
+        reader.read(s.controller);
+        reader.read(s.autopilot);
+        reader.read(s.sensors);
+        reader.read(s.navigation);
+    }
+
+    // --- Apply ---
+    tick_        = tick;
+    pendingTime_ = pendingTime;
+
+    for (std::size_t i = 0; i < landers_.size(); ++i)
+    {
+        LanderInstance& l = landers_[i];
+        const LanderSections& s = sections[i];
+
+        l.craft->restoreCheckpoint(s.craft);
+        l.arbiter->restoreCheckpoint(s.arbiter);
+        l.controller->restoreCheckpoint(s.controller);
+        l.autopilot->restoreCheckpoint(s.autopilot);
+        l.sensors->restoreCheckpoint(s.sensors);
+        l.navigation->restoreCheckpoint(s.navigation);
+        l.telemetry = l.craft->getFullSimulationData();
+    }
+}
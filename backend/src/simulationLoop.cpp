@@ -0,0 +1,220 @@
+#include "simulationLoop.h"
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+SimulationLoop::SimulationLoop(double framePeriod)
+    : framePeriod_(framePeriod)
+{
+    if (!(framePeriod_ > 0.0))
+    {
+        throw std::runtime_error("SimulationLoop: frame period must be positive");
+    }
+
+    thread_ = std::thread(&SimulationLoop::run, this);
+}
+
+SimulationLoop::~SimulationLoop()
+{
+    quit_.store(true, std::memory_order_relaxed);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+bool SimulationLoop::send(SimCommand command)
+{
+    return commands_.push(std::move(command));
+}
+
+bool SimulationLoop::latestFrame(SimFrame& out)
+{
+    if (!telemetry_.update())
+        return false;
+
+    out = telemetry_.front();
+    return true;
+}
+
+bool SimulationLoop::pollEvent(SimEvent& out)
+{
+    return events_.pop(out);
+}
+
+double SimulationLoop::framePeriod() const
+{
+    return framePeriod_;
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+void SimulationLoop::run()
+{
+    using clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(framePeriod_));
+
+    auto next = clock::now();
+    SimCommand command;
+
+    while (!quit_.load(std::memory_order_relaxed))
+    {
+        while (commands_.pop(command))
+        {
+            apply(command);
+        }
+
+        if (running_)
+        {
+            step();
+        }
+
+        // --- Fixed frame rate; an overrun shifts the schedule instead of bursting ---
+        next += period;
+        const auto now = clock::now();
+        if (next < now)
+        {
+            next = now;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void SimulationLoop::apply(SimCommand& command)
+{
+    switch (command.type)
+    {
+    case SimCommand::Type::Start:
+        if (!command.config.empty())
+        {
+            config_ = std::move(command.config);
+        }
+
+        // Resume after pause, otherwise build a fresh simulation
+        if (!paused_ || !sim_)
+        {
+            try
+            {
+                sim_ = std::make_unique<simcontrol>(0);
+                sim_->initialize(config_);
+                snapshots_.clear();
+                snapshots_.record(*sim_);
+            }
+            catch (const std::exception& e)
+            {
+                sim_.reset();
+                notify(SimEvent::Type::Error, 0.0, std::string("Simulation start failed: ") + e.what());
+                return;
+            }
+        }
+        paused_  = false;
+        running_ = true;
+        break;
+
+    case SimCommand::Type::Pause:
+        running_ = false;
+        paused_  = true;
+        break;
+
+    case SimCommand::Type::Stop:
+        running_ = false;
+        paused_  = false;
+        snapshots_.clear();
+        if (sim_)
+        {
+            sim_->setResetBoolean();
+        }
+        publish(true);
+        break;
+
+    case SimCommand::Type::Control:
+        frontEnd_ = command.control;
+        break;
+
+    case SimCommand::Type::Rewind:
+        if (!sim_)
+            break;
+
+        try
+        {
+            if (snapshots_.rewind(*sim_, command.value))
+            {
+                publish(false);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            notify(SimEvent::Type::Error, 0.0, std::string("Rewind failed: ") + e.what());
+        }
+        break;
+
+    case SimCommand::Type::TimeWarp:
+        requestedWarp_ = command.value;
+        break;
+    }
+}
+
+void SimulationLoop::step()
+{
+    try
+    {
+        // Apply time warp: one frame covers framePeriod * warp, still integrated in ticks
+        const double warp = sim_->allowedTimeWarp(requestedWarp_);
+        if (warp != effectiveWarp_)
+        {
+            effectiveWarp_ = warp;
+            notify(SimEvent::Type::TimeWarpChanged, effectiveWarp_);
+        }
+
+        sim_->advanceSimulation(framePeriod_ * warp, framePeriod_);
+
+        // Keep rewind history (records once per snapshot interval)
+        snapshots_.record(*sim_);
+
+        // Withdraw user input due to thrust
+        sim_->receiveCommandFromFrontEnd(frontEnd_);
+    }
+    catch (const std::exception& e)
+    {
+        running_ = false;
+        paused_  = true;
+        notify(SimEvent::Type::Error, 0.0, e.what());
+        return;
+    }
+
+    publish(false);
+}
+
+void SimulationLoop::publish(bool stopped)
+{
+    SimFrame& out = telemetry_.back();
+    out.frame         = ++frame_;
+    out.stopped       = stopped;
+    out.effectiveWarp = effectiveWarp_;
+
+    if (stopped || !sim_)
+    {
+        out.time = 0.0;
+        out.stopped = true;
+    }
+    else
+    {
+        out.time = sim_->getSimulationTime();
+        out.data = sim_->getTelemetry(0);
+    }
+
+    telemetry_.publish();
+}
+
+void SimulationLoop::notify(SimEvent::Type type, double value, const std::string& message)
+{
+    if (!events_.push(SimEvent{type, value, message}))
+    {
+        std::cerr << "[SimulationLoop] Event queue full, dropped event: " << message << std::endl;
+    }
+}
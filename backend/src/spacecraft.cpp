@@ -3,21 +3,25 @@
 #include "Physics/basicMoonGravityModel.h"
 #include "Integrators/eulerIntegrator.h"
 #include "Sensory_Perception/sensorModel.h"
+#include "Terrain/sphericalTerrainModel.h"
+#include "Integrators/keplerPropagator.h"
 
 #include <iostream>
+#include <stdexcept>
 // -------------------------------------------------------------------------
 // Private
 // -------------------------------------------------------------------------
 
 void spacecraft::setDefaultValues()
 {
+    terrain_ = std::make_shared<SphericalTerrainModel>();
     spacecraftIntegrity = 1.0;
     spacecraftState_ = SpacecraftState::Operational;
     totalMass = landerMoon.emptyMass + landerMoon.fuelM;
-    state_.I_Position = landerMoon.I_initialPos;
+    setPosition(landerMoon.I_initialPos);
     state_.I_Velocity = landerMoon.I_initialVelocity;
 
-    thrustOrchestration.initializeEngines(landerMoon.engines_, landerMoon.tanks_);
+    thrustOrchestration.initializeEngines(landerMoon.engines_, landerMoon.tanks_, landerMoon.B_initialCenterOfMass);
 
 
     // TODO just testing here optimization
@@ -44,18 +48,23 @@ void spacecraft::updateMovementData(double dt)
         return;
     }
 
-    // --- Compute acceleration ---
+    // --- Thrust force, rotated from the body into the inertial frame ---
     //TODO: eliminate minus with request thrust when coordinate transformation class is written
-    Vector3 acceleration = physics_->computeAcc(getPosition(), getVelocity(), getTotalMass(), -requestTotalThrust());
+    Vector3 thrust = getOrientation().rotate(-requestTotalThrust());
+
+    // --- Compute acceleration ---
+    Vector3 acceleration = physics_->computeAcc(getPosition(), getVelocity(), getTotalMass(), thrust, time);
 
     // --- Compute velocity ---
     Vector3 velocity = physics_->computeVel(getVelocity(), acceleration, dt);
 
-    // --- Compute position ---
-    Vector3 position = physics_->computePos(getPosition(), velocity, acceleration, dt);
+    // --- Compute position (integrated in the local frame) ---
+    Vector3 position = physics_->computePos(localPosition_, velocity, acceleration, dt);
 
-    // --- TODO: Compute orientation and angular velocity ---
-    // ...
+    // --- Compute orientation and angular velocity ---
+    Quaternion orientation  = getOrientation();
+    Vector3 angularVelocity = getAngularVelocity();
+    attitude_.propagate(orientation, angularVelocity, thrustOrchestration.getCurrentTorque(landerMoon.B_initialCenterOfMass), dt);
 
     // --- TODO: Update total mass ---
     // ...
@@ -64,7 +73,9 @@ void spacecraft::updateMovementData(double dt)
 
     // --- Commit to state vector ---
     setVelocity(velocity);
-    setPosition(position);
+    setLocalPosition(position);
+    setOrientation(orientation);
+    setAngularVelocity(angularVelocity);
     //setGload(GLoad);
 }
 
@@ -73,6 +84,7 @@ void spacecraft::updateMovementDataToZero(double dt)
     Vector3 zeroVector = {0.0, 0.0, 0.0};
     // --- Commit to state vector ---
     setVelocity(zeroVector);
+    setAngularVelocity(zeroVector);
     updateGLoad(zeroVector, environmentConfig_.moonGravityVec);
 }
 
@@ -109,9 +121,17 @@ void spacecraft::applyLandingDamage(double impactVelocity)
 
 void spacecraft::setPosition(const Vector3& pos)
 {
+    localPosition_ = origin_.reset(pos);
     state_.I_Position = pos;
 }
 
+void spacecraft::setLocalPosition(const Vector3& localPos)
+{
+    localPosition_ = localPos;
+    origin_.rebase(localPosition_);
+    state_.I_Position = origin_.toAbsolute(localPosition_);
+}
+
 void spacecraft::setVelocity(const Vector3& vel)
 {
     state_.I_Velocity = vel;
@@ -130,34 +150,53 @@ void spacecraft::setAngularVelocity(const Vector3& angVel)
 // -------------------------------------------------------------------------
 // Public
 // -------------------------------------------------------------------------
-spacecraft::spacecraft(customSpacecraft lMoon) : landerMoon(lMoon)
+spacecraft::spacecraft(customSpacecraft lMoon) : landerMoon(lMoon), attitude_({lMoon.Ixx, lMoon.Iyy, lMoon.Izz})
     {
         // initialize
         std::shared_ptr<IPhysicsModel> model_       = std::make_shared<BasicMoonGravityModel>(environmentConfig_);
         std::shared_ptr<IIntegrator> integrator_    = std::make_shared<EulerIntegrator>();
-        std::shared_ptr<ISensor> sensor_            = std::make_shared<SensorModel>(environmentConfig_);
+        std::shared_ptr<SensorModel> sensor_          = std::make_shared<SensorModel>(environmentConfig_);
 
         physics_ = std::make_unique<physics>(model_, integrator_, sensor_);
 
         setDefaultValues();
     };
 
+spacecraft::spacecraft(customSpacecraft lMoon, std::shared_ptr<IPhysicsModel> sharedModel) : landerMoon(lMoon), attitude_({lMoon.Ixx, lMoon.Iyy, lMoon.Izz})
+{
+    std::shared_ptr<IIntegrator> integrator_    = std::make_shared<EulerIntegrator>();
+    std::shared_ptr<SensorModel> sensor_          = std::make_shared<SensorModel>(environmentConfig_);
+
+    physics_ = std::make_unique<physics>(sharedModel, integrator_, sensor_);
+
+    setDefaultValues();
+}
+
 spacecraft::~spacecraft()
 {
 }
 
 void spacecraft::updateStep(double dt)
+{
+    updatePropulsion(dt);
+    updateDynamics(dt);
+}
+
+void spacecraft::updatePropulsion(double dt)
 {
     // Update mass data
     updateTotalMassOnFuelReduction(landerMoon.emptyMass, getTotalFuelMass());
 
     thrustOrchestration.updateThrust(dt);
+}
 
+void spacecraft::updateDynamics(double dt)
+{
     // Update time systems are running
     time += dt;
 
     // Apply landing damage
-    if (state_.I_Position.z <= environmentConfig_.radiusMoon)
+    if (getAltitude() <= 0.0)
     {
         applyLandingDamage(state_.I_Velocity.z);
     }
@@ -209,7 +248,7 @@ void spacecraft::updateSpacecraftIntegrity()
     }
 
     // 3. Successful touchdown
-    if (getPosition().z <= environmentConfig_.radiusMoon)
+    if (getAltitude() <= 0.0)
     {
         spacecraftState_ = SpacecraftState::Landed;
         return;
@@ -219,6 +258,35 @@ void spacecraft::updateSpacecraftIntegrity()
     spacecraftState_ = SpacecraftState::Operational;
 }
 
+void spacecraft::coast(double duration)
+{
+    const std::optional<double> mu = physics_->keplerianParameter();
+
+    if (!isCoasting() || !mu)
+    {
+        throw std::runtime_error("spacecraft: coast requested while not coasting");
+    }
+
+    Vector3 position = getPosition();
+    Vector3 velocity = getVelocity();
+    KeplerPropagator(*mu).propagate(position, velocity, duration);
+
+    Quaternion orientation  = getOrientation();
+    Vector3 angularVelocity = getAngularVelocity();
+    attitude_.coast(orientation, angularVelocity, duration);
+
+    time += duration;
+
+    setVelocity(velocity);
+    setPosition(position);
+    setOrientation(orientation);
+    setAngularVelocity(angularVelocity);
+
+    // Free fall: same G-load bookkeeping as a regular step without thrust
+    Vector3 acceleration = physics_->computeAcc(position, velocity, getTotalMass(), Vector3{0.0, 0.0, 0.0}, time);
+    updateGLoad(acceleration, environmentConfig_.moonGravityVec);
+}
+
 void spacecraft::setMainEngineThrust(const double &targetThrustInPercentage)
 {
     (getSpacecraftState() == SpacecraftState::Operational) ? thrustOrchestration.setTargetThrustInPercentage(EngineType::MainEngine, targetThrustInPercentage) : thrustOrchestration.setTargetThrustInPercentage(EngineType::MainEngine, 0.0);
@@ -234,6 +302,21 @@ void spacecraft::setConsoleText(const std::string &txt)
     consoleTxt = txt;
 }
 
+void spacecraft::setTerrainModel(std::shared_ptr<const ITerrainModel> terrain)
+{
+    terrain_ = terrain ? std::move(terrain) : std::make_shared<SphericalTerrainModel>();
+}
+
+void spacecraft::setPhysicsModel(std::shared_ptr<IPhysicsModel> model)
+{
+    physics_->setModel(model);
+}
+
+void spacecraft::addPerturbation(std::shared_ptr<const IPerturbation> perturbation)
+{
+    physics_->addPerturbation(perturbation);
+}
+
 std::vector<double> spacecraft::compute_optimization(double h0, double v0, double m0, double dt)
 {
     ThrustOptimizationProblem problem;
@@ -330,6 +413,11 @@ double spacecraft::requestMainEngineLiveFuelConsumption() const
     return thrustOrchestration.getFuelConsumption(EngineType::MainEngine);
 }
 
+double spacecraft::requestRCSLiveFuelConsumption() const
+{
+    return thrustOrchestration.getFuelConsumption(EngineType::RCS);
+}
+
 void spacecraft::setInitalPosition(const Vector3& position)
 {
     landerMoon.I_initialPos = position;
@@ -384,6 +472,21 @@ Vector3 spacecraft::getPosition() const
     return state_.I_Position;
 }
 
+Vector3 spacecraft::getLocalPosition() const
+{
+    return localPosition_;
+}
+
+const Vector3& spacecraft::getOrigin() const
+{
+    return origin_.origin();
+}
+
+double spacecraft::getAltitude() const
+{
+    return state_.I_Position.norm() - environmentConfig_.radiusMoon - terrain_->heightAt(state_.I_Position);
+}
+
 Vector3 spacecraft::getVelocity() const
 {
     return state_.I_Velocity;
@@ -399,6 +502,18 @@ Vector3 spacecraft::getAngularVelocity() const
     return state_.B_AngularVelocity;
 }
 
+Vector3 spacecraft::getSpecificForce() const
+{
+    if (spacecraftState_ == SpacecraftState::Operational)
+    {
+        return -requestTotalThrust() / state_.totalMass;
+    }
+
+    // Resting on the ground: the surface pushes up against gravity
+    Vector3 I_up = state_.I_Position.normalized();
+    return getOrientation().rotateInverse(I_up * environmentConfig_.moonGravity);
+}
+
 double spacecraft::getTotalMass()
 {
     return state_.totalMass;
@@ -423,3 +538,65 @@ std::string spacecraft::getConsoleTxt() const
 {
     return consoleTxt;
 }
+
+double spacecraft::getTime() const
+{
+    return time;
+}
+
+bool spacecraft::isCoasting() const
+{
+    return spacecraftState_ == SpacecraftState::Operational
+        && requestTotalThrust().norm() < IDLE_THRUST
+        && thrustOrchestration.getTargetThrust().norm() == 0.0
+        && physics_->keplerianParameter().has_value();
+}
+
+double spacecraft::timeToAltitude(double altitude) const
+{
+    if (!isCoasting())
+        return KeplerPropagator::NEVER;
+
+    const KeplerPropagator propagator(*physics_->keplerianParameter());
+    return propagator.timeToRadius(getPosition(), getVelocity(), environmentConfig_.radiusMoon + altitude);
+}
+
+// -------------------------------------------------------------------------
+// Checkpoint
+// -------------------------------------------------------------------------
+void spacecraft::writeCheckpoint(CheckpointWriter &writer) const
+{
+    SpacecraftCheckpoint checkpoint;
+    checkpoint.state                = state_;
+    checkpoint.localPosition        = localPosition_;
+    checkpoint.origin               = origin_.origin();
+    checkpoint.spacecraftState      = spacecraftState_;
+    checkpoint.spacecraftIntegrity  = spacecraftIntegrity;
+    checkpoint.totalMass            = totalMass;
+    checkpoint.time                 = time;
+    checkpoint.GLoad                = GLoad;
+
+    writer.write(checkpoint);
+    thrustOrchestration.writeCheckpoint(writer);
+}
+
+void spacecraft::readCheckpoint(CheckpointReader &reader, SpacecraftCheckpointSection &out) const
+{
+    reader.read(out.spacecraft);
+    thrustOrchestration.readCheckpoint(reader, out.propulsion);
+}
+
+void spacecraft::restoreCheckpoint(const SpacecraftCheckpointSection &section)
+{
+    const SpacecraftCheckpoint& checkpoint = section.spacecraft;
+    thrustOrchestration.restoreCheckpoint(section.propulsion);
+
+    state_              = checkpoint.state;
+    localPosition_      = checkpoint.localPosition;
+    origin_.setOrigin(checkpoint.origin);
+    spacecraftState_    = checkpoint.spacecraftState;
+    spacecraftIntegrity = checkpoint.spacecraftIntegrity;
+    totalMass           = checkpoint.totalMass;
+    time                = checkpoint.time;
+    GLoad               = checkpoint.GLoad;
+}
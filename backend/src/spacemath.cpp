@@ -1,30 +1,39 @@
 #include "spacemath.h"
 
-double spacemath::kineticEnergy(double mass, double velocity)
+template<typename T>
+T spacemathT<T>::kineticEnergy(T mass, T velocity)
 {
-    return 0.5 * mass * velocity * velocity;
+    return T(0.5) * mass * velocity * velocity;
 }
 
-double spacemath::accelerationBasedOnThrust(double thrust, double mass)
+template<typename T>
+T spacemathT<T>::accelerationBasedOnThrust(T thrust, T mass)
 {
     return thrust / mass;
 }
 
-Vector3 spacemath::accelerationComplex(double currentThrust, double totalMass, Vector3 directionOfThrust, Vector3 gravityConstant)
+template<typename T>
+Vector3T<T> spacemathT<T>::accelerationComplex(T currentThrust, T totalMass, Vector3T<T> directionOfThrust, Vector3T<T> gravityConstant)
 {
     // F^_thrust = F_scalar * d^_thrust
-    Vector3 F_thrust =  directionOfThrust * currentThrust;
+    Vector3T<T> F_thrust =  directionOfThrust * currentThrust;
 
     // F = m * a <-> a = F / m 
     return F_thrust / totalMass + gravityConstant;
 }
 
-Vector3 spacemath::calcAccelerationVector(double currentThrust, Vector3 thrustDirection)
+template<typename T>
+Vector3T<T> spacemathT<T>::calcAccelerationVector(T currentThrust, Vector3T<T> thrustDirection)
 {
     return thrustDirection * currentThrust;
 }
 
-double spacemath::calcMassFlowBasedOnThrust(double currenThrust, double Isp, double earthGravity)
+template<typename T>
+T spacemathT<T>::calcMassFlowBasedOnThrust(T currenThrust, T Isp, T earthGravity)
 {
     return currenThrust / (Isp * earthGravity); 
 }
+
+// explicit instantiations
+template class spacemathT<double>;
+template class spacemathT<float>;
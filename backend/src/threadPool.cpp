@@ -0,0 +1,117 @@
+#include "threadPool.h"
+
+// -------------------------------------------------------------------------
+// Public
+// -------------------------------------------------------------------------
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        const unsigned hw = std::thread::hardware_concurrency();
+        threadCount = hw > 1 ? hw - 1 : 1;
+    }
+
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    jobAvailable_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& fn)
+{
+    if (count == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &fn;
+        jobCount_ = count;
+        nextIndex_.store(0, std::memory_order_relaxed);
+        activeWorkers_ = workers_.size();
+        error_ = nullptr;
+        ++generation_;
+    }
+    jobAvailable_.notify_all();
+
+    // The caller works as well
+    runJob();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    jobDone_.wait(lock, [this] { return activeWorkers_ == 0; });
+    job_ = nullptr;
+
+    if (error_)
+    {
+        std::rethrow_exception(error_);
+    }
+}
+
+std::size_t ThreadPool::threadCount() const
+{
+    return workers_.size();
+}
+
+// -------------------------------------------------------------------------
+// Private
+// -------------------------------------------------------------------------
+void ThreadPool::workerLoop()
+{
+    std::size_t seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            jobAvailable_.wait(lock, [&] { return stop_ || generation_ != seenGeneration; });
+
+            if (stop_)
+                return;
+
+            seenGeneration = generation_;
+        }
+
+        runJob();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --activeWorkers_;
+        }
+        jobDone_.notify_one();
+    }
+}
+
+void ThreadPool::runJob()
+{
+    while (true)
+    {
+        const std::size_t i = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        if (i >= jobCount_)
+            return;
+
+        try
+        {
+            (*job_)(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_)
+                error_ = std::current_exception();
+        }
+    }
+}
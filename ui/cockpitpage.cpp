@@ -1,5 +1,6 @@
 #include "cockpitpage.h"
 #include "Thrust/FueltankStruct.h"
+#include "Control/timeWarpGovernor.h"
 
 #include <QGridLayout>
 #include <QPushButton>
@@ -360,6 +361,7 @@ QGroupBox *cockpitPage::setupLandingBox()
 
     landingView = new LandingView(this);
     landingView->setMinimumSize(240, 180);
+    landingView->setOffThreadRendering(true); // keep the GUI thread free for input and LCD updates
     landingLayout->addWidget(landingView, 1);
 
     // === Thrust Control Console ===
@@ -388,6 +390,31 @@ QGroupBox *cockpitPage::setupLandingBox()
     simControlLayout->addWidget(btnSimPause);
     simControlLayout->addWidget(btnSimStop);
 
+    // === Rewind ===
+    QHBoxLayout *rewindLayout = new QHBoxLayout();
+    spinRewind = new QSpinBox();
+    spinRewind->setRange(1, 600);   // history holds the last 10 minutes
+    spinRewind->setValue(30);
+    spinRewind->setSuffix(" s");
+    btnRewind = new QPushButton("REWIND");
+
+    rewindLayout->addWidget(spinRewind, 1);
+    rewindLayout->addWidget(btnRewind);
+
+    // === Time Warp ===
+    QHBoxLayout *warpLayout = new QHBoxLayout();
+    comboTimeWarp = new QComboBox();
+    for (const double level : TimeWarpGovernor::LEVELS)
+    {
+        comboTimeWarp->addItem(QString("x%1").arg(level), level);
+    }
+    comboTimeWarp->setFocusPolicy(Qt::NoFocus);     // keep keyboard input on the cockpit
+    lblTimeWarp = new QLabel("WARP: x1");
+    lblTimeWarp->setStyleSheet("color: gray; font-weight: bold;");
+
+    warpLayout->addWidget(comboTimeWarp, 1);
+    warpLayout->addWidget(lblTimeWarp);
+
     // === Autopilot Toggle ===
     btnAutopilot = new QPushButton("AUTOPILOT OFF");
     btnAutopilot->setCheckable(true);
@@ -400,6 +427,8 @@ QGroupBox *cockpitPage::setupLandingBox()
 
 
     landingLayout->addLayout(simControlLayout);
+    landingLayout->addLayout(rewindLayout);
+    landingLayout->addLayout(warpLayout);
 
     return landingBox;
 }
@@ -413,6 +442,16 @@ void cockpitPage::setupConnections()
     connect(btnSimPause, &QPushButton::clicked, this, &cockpitPage::pauseRequested);    ///< Emits signal
     connect(btnSimStop,  &QPushButton::clicked, this, &cockpitPage::onStopClicked);     ///< Combined with private slot
 
+    connect(btnRewind, &QPushButton::clicked, this, [this]
+    {
+        emit rewindRequested(static_cast<double>(spinRewind->value()));
+    });
+
+    connect(comboTimeWarp, &QComboBox::currentIndexChanged, this, [this](int index)
+    {
+        emit timeWarpRequested(comboTimeWarp->itemData(index).toDouble());
+    });
+
     connect(thrustSlider, &QSlider::valueChanged, this, [this](int value)
     {
         lblThrustCmd->setText(QString("Commanded Thrust: %1 %").arg(value));
@@ -752,11 +791,9 @@ void cockpitPage::onStateUpdated(double time,
     updateFuelFlow(qRound(fuelFlow * 100.0) / 100.0);
     updateHullStatus(spacecraftState_);
 
-    landingView->setPositionENU(pos);
-    landingView->setVelocityENU(vel);
+    landingView->pushFrame(time, pos, vel, -thrustInPercentage.z);
     landingView->setYawDeg(0.0);          // DUMMY later from Quaternion/Euler
     landingView->setTargetENU({0,0,0});   // DUMMY
-    landingView->setThrust(-thrustInPercentage.z);
     landingView->setRCSActive(thrust);
     landingView->setHullIntact(spacecraftState_);
 
@@ -764,6 +801,21 @@ void cockpitPage::onStateUpdated(double time,
 
 }
 
+void cockpitPage::onTimeWarpChanged(double effectiveWarp)
+{
+    const double requested = comboTimeWarp->currentData().toDouble();
+
+    lblTimeWarp->setText(QString("WARP: x%1").arg(effectiveWarp));
+
+    // Highlight when the simulation holds the warp below the selected level
+    if (effectiveWarp < requested)
+        lblTimeWarp->setStyleSheet("color: orange; font-weight: bold;");
+    else if (effectiveWarp > 1.0)
+        lblTimeWarp->setStyleSheet("color: #4FC3F7; font-weight: bold;");
+    else
+        lblTimeWarp->setStyleSheet("color: gray; font-weight: bold;");
+}
+
 void cockpitPage::onStopClicked()
 {
     auto reply = QMessageBox::question(
@@ -10,6 +10,7 @@
 #ifndef COCKPITPAGE_H
 #define COCKPITPAGE_H
 
+#include <QComboBox>
 #include <QGroupBox>
 #include <QWidget>
 #include <QLCDNumber>
@@ -17,6 +18,7 @@
 #include <QMessageBox>
 #include <QPushButton>
 #include <QSlider>
+#include <QSpinBox>
 #include <QProgressBar>
 #include <QScrollArea>
 #include <QVBoxLayout>
@@ -171,6 +173,18 @@ signals:
      */
     void resetSimulationRequested();
 
+    /**
+     * @brief Emitted when the user requests a rewind.
+     * @param seconds Simulated time to rewind [s].
+     */
+    void rewindRequested(double seconds);
+
+    /**
+     * @brief Emitted when the user selects a time warp level.
+     * @param factor Requested warp factor [-].
+     */
+    void timeWarpRequested(double factor);
+
     /**
      * @brief Emitted when the user changes the thrust slider.
      * @param percent Target thrust in percent.
@@ -219,6 +233,16 @@ public slots:
                         double fuelFlow,
                         QString consoleOutput);
 
+    /**
+     * @brief Slot receiving the warp level actually applied by the simulation.
+     *
+     * The simulation may run slower than requested while thrust is active,
+     * the G-load is high or the lander is close to the ground.
+     *
+     * @param effectiveWarp Applied warp factor [-].
+     */
+    void onTimeWarpChanged(double effectiveWarp);
+
 private slots:
     /**
      * @brief Handles stop button click including confirmation dialog.
@@ -452,6 +476,12 @@ private:
     QPushButton *btnSimPause; ///< Simulation pause button
     QPushButton *btnSimStop;  ///< Simulation stop button
 
+    QPushButton *btnRewind = nullptr;   ///< Rewind button
+    QSpinBox *spinRewind = nullptr;     ///< Rewind amount [s]
+
+    QComboBox *comboTimeWarp = nullptr; ///< Requested time warp level
+    QLabel *lblTimeWarp = nullptr;      ///< Displays the applied time warp
+
     // =====================================================
     // Thrust Controle Console
     // =====================================================
@@ -1,5 +1,7 @@
 #include "configmanager.h"
 
+#include <QDebug>
+
 ConfigManager::ConfigManager(QObject *parent) : QObject(parent)
 {
 
@@ -7,25 +9,39 @@ ConfigManager::ConfigManager(QObject *parent) : QObject(parent)
 
 bool ConfigManager::loadConfig(const QString& path)
 {
-    QFile file(path);
-
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
-        return false;
-
-    rawJson = QString::fromUtf8(file.readAll());
+    catalog.close();
+    catalogData = nullptr;
+    rawJson.clear();
+    if (configFile.isOpen())
+        configFile.close();
 
-    QJsonDocument doc = QJsonDocument::fromJson(rawJson.toUtf8());
+    configFile.setFileName(path);
 
-    if (!doc.isObject())
+    if (!configFile.open(QIODevice::ReadOnly))
         return false;
 
-    spacecraftList.clear();
+    // Map the file so only the pages of selected entries become resident.
+    // Compressed Qt resources cannot be mapped; fall back to a single read.
+    const char* data = reinterpret_cast<const char*>(configFile.map(0, configFile.size()));
+    qint64 size = configFile.size();
 
-    QJsonArray arr = doc.object()["spacecraft"].toArray();
+    if (data == nullptr)
+    {
+        rawJson = configFile.readAll();
+        configFile.close();
+        data = rawJson.constData();
+        size = rawJson.size();
+    }
 
-    for (const QJsonValue &val : arr)
+    try
+    {
+        catalog.openBuffer(data, static_cast<std::size_t>(size));
+        catalogData = data;
+    }
+    catch (const std::exception& e)
     {
-        spacecraftList.append(val.toObject());
+        qWarning() << "[ConfigManager] Failed to index" << path << ":" << e.what();
+        return false;
     }
 
     emit jsonLoaded();
@@ -35,39 +51,48 @@ bool ConfigManager::loadConfig(const QString& path)
 
 int ConfigManager::spacecraftCount() const
 {
-    return spacecraftList.size();
+    return static_cast<int>(catalog.size());
 }
 
 QString ConfigManager::spacecraftName(int index) const
 {
-    if(index < 0 || index >= spacecraftList.size())
+    if(index < 0 || index >= spacecraftCount())
         return "Invalid spacecraft";
 
-    return spacecraftList[index]["name"].toString("Unnamed spacecraft");
+    const std::string& name = catalog.entry(index).name;
+    if (name.empty())
+        return "Unnamed spacecraft";
+
+    return QString::fromStdString(name);
 }
 
 QJsonObject ConfigManager::spacecraftObject(int index) const
 {
-    if(index < 0 || index >= spacecraftList.size())
+    if(index < 0 || index >= spacecraftCount())
         return {};
 
-    return spacecraftList[index];
+    return QJsonDocument::fromJson(rawSpacecraft(index)).object();
 }
 
 QString ConfigManager::spacecraftJson(int index) const
 {
-    if(index < 0 || index >= spacecraftList.size())
+    if(index < 0 || index >= spacecraftCount())
         return {};
 
-    QJsonDocument doc(spacecraftList[index]);
+    QJsonDocument doc(spacecraftObject(index));
     return QString::fromUtf8(doc.toJson(QJsonDocument::Compact));
 }
 
 QString ConfigManager::defaultSpacecraftJson() const
 {
-    if(spacecraftList.isEmpty())
+    if(spacecraftCount() == 0)
         return {};
 
-    QJsonDocument doc(spacecraftList[0]);
-    return QString::fromUtf8(doc.toJson(QJsonDocument::Compact));
+    return spacecraftJson(0);
+}
+
+QByteArray ConfigManager::rawSpacecraft(int index) const
+{
+    const CatalogEntry& entry = catalog.entry(index);
+    return QByteArray::fromRawData(catalogData + entry.offset, static_cast<qsizetype>(entry.length));
 }
@@ -6,6 +6,9 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QFile>
+#include <QByteArray>
+
+#include "jsonCatalogReader.h"
 
 /**
  * @class ConfigManager
@@ -25,6 +28,11 @@
  * }
  * @endcode
  *
+ * The file is not parsed into a DOM. Instead the spacecraft array is indexed
+ * once by the streaming @ref jsonCatalogReader and individual entries are
+ * parsed only when they are requested, so catalogs with tens of thousands of
+ * entries can be browsed with bounded memory and O(1) selection.
+ *
  * After successfully loading a configuration file, the manager emits
  * the signal jsonLoaded() to notify interested UI components or systems
  * that configuration data is available.
@@ -45,8 +53,8 @@ public:
     /**
      * @brief Loads and parses a spacecraft configuration file.
      *
-     * The file is read from disk and parsed into internal JSON structures.
-     * The spacecraft array is extracted and stored internally.
+     * The file is memory-mapped where possible (otherwise read once) and the
+     * spacecraft array is indexed by byte offset. No entry is parsed here.
      *
      * If loading succeeds, the signal jsonLoaded() is emitted.
      *
@@ -113,15 +121,31 @@ signals:
 private:
 
     /**
-     * @brief Raw JSON configuration string loaded from file.
+     * @brief Returns the raw JSON bytes of a spacecraft entry.
+     *
+     * The returned array references the mapped file data and does not copy it.
+     */
+    QByteArray rawSpacecraft(int index) const;
+
+    /**
+     * @brief Configuration file; kept open while its contents are mapped.
+     */
+    QFile configFile;
+
+    /**
+     * @brief Raw JSON bytes if the file could not be mapped (e.g. compressed resources).
+     */
+    QByteArray rawJson;
+
+    /**
+     * @brief Start of the indexed JSON text (mapped file or @ref rawJson).
      */
-    QString rawJson;
+    const char* catalogData = nullptr;
 
     /**
-     * @brief Parsed list of spacecraft configuration objects.
+     * @brief Byte-offset index of the spacecraft array.
      *
-     * Each entry represents one spacecraft configuration extracted
-     * from the JSON file.
+     * Points into either the mapped file or @ref rawJson.
      */
-    QList<QJsonObject> spacecraftList;
+    jsonCatalogReader catalog;
 };
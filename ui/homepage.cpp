@@ -149,6 +149,15 @@ void Homepage::setupThread()
     connect(cockpit, &cockpitPage::stopConfirmed,
             simulationWorker, &SimulationWorker::stop);
 
+    connect(cockpit, &cockpitPage::rewindRequested,
+            simulationWorker, &SimulationWorker::rewind);
+
+    connect(cockpit, &cockpitPage::timeWarpRequested,
+            simulationWorker, &SimulationWorker::setTimeWarp);
+
+    connect(simulationWorker, &SimulationWorker::timeWarpChanged,
+            cockpit, &cockpitPage::onTimeWarpChanged);
+
     connect(this, &Homepage::sendJsonToWorker, simulationWorker,
             &SimulationWorker::receiveJsonConfig, Qt::QueuedConnection);
 
@@ -17,6 +17,21 @@
  * The widget is passive and only visualizes values provided
  * through update functions.
  *
+ * Frame pacing:
+ * - Telemetry arrives at the simulation frame rate via pushFrame().
+ * - The widget repaints at the display refresh rate and interpolates
+ *   position, velocity and thrust between the latest two frames.
+ * - Rendering runs one telemetry frame behind, so the drawn state is
+ *   always between two real samples and never extrapolated.
+ *
+ * Rendering cost:
+ * - Background, panel frames, grids and fixed labels are cached in an image
+ *   that is rebuilt only on resize.
+ * - Only panels whose content changed are repainted.
+ * - The trajectory is a fixed-capacity ring drawn as one polyline.
+ * - Optionally the scene is drawn on a render thread and the widget only
+ *   blits the finished image (setOffThreadRendering()).
+ *
  * Coordinate Convention:
  * - X → East
  * - Y → North
@@ -36,12 +51,19 @@
 
 #include <QWidget>
 #include <QTimer>
+#include <QElapsedTimer>
 #include <QVector>
 #include <QPointF>
+#include <QImage>
+#include <QRegion>
+#include <QThread>
 
 #include <spacecraftStateStruct.h>
 #include <vector3.h>
 
+#include "landingviewscene.h"
+#include "landingviewrenderer.h"
+
 /**
  * @class LandingView
  * @brief 2.5D landing visualization widget.
@@ -77,29 +99,34 @@ public:
      */
     explicit LandingView(QWidget *parent = nullptr);
 
+    /**
+     * @brief Stops the render thread, if any.
+     */
+    ~LandingView() override;
+
     // =====================================================
     // Public Update Interface (Simulation → UI)
     // =====================================================
 
     /**
-     * @brief Updates spacecraft position in ENU frame.
+     * @brief Adds a telemetry frame to interpolate towards.
+     *
+     * The view moves from the previous frame to this one over one measured
+     * frame interval. A frame at or before the latest time (rewind, stop) or
+     * after a long gap (pause, restart) is shown immediately.
      *
+     * @param time Simulation time of the frame [s]
      * @param pos Position vector:
      * - x → East [m]
      * - y → North [m]
      * - z → Up (altitude) [m]
-     */
-    void setPositionENU(const Vector3& pos);
-
-    /**
-     * @brief Updates spacecraft velocity in ENU frame.
-     *
      * @param vel Velocity vector:
      * - x → East velocity [m/s]
      * - y → North velocity [m/s]
      * - z → Vertical velocity [m/s]
+     * @param thrust Main engine thrust level [0–1]
      */
-    void setVelocityENU(const Vector3& vel);
+    void pushFrame(double time, const Vector3& pos, const Vector3& vel, double thrust);
 
     /**
      * @brief Updates yaw angle for top view visualization.
@@ -120,13 +147,6 @@ public:
      */
     void setTargetENU(const Vector3& target);
 
-    /**
-     * @brief Updates engine thrust level.
-     *
-     * @param percent Thrust percentage [0–100].
-     */
-    void setThrust(double percent);
-
     /**
      * @brief Updates RCS active switch
      * @param current thrust vector
@@ -146,6 +166,18 @@ public:
      */
     void setHullIntact(SpacecraftState spacecraftState_);
 
+    /**
+     * @brief Moves scene drawing to a background thread.
+     *
+     * When enabled, each display frame with changes hands a copy of the scene
+     * to a LandingViewRenderer, and paintEvent only blits its newest image.
+     * Scenes the renderer could not keep up with are dropped. When disabled,
+     * the scene is painted directly in paintEvent.
+     *
+     * @param enabled True to render off the GUI thread
+     */
+    void setOffThreadRendering(bool enabled);
+
 protected:
     /**
      * @brief Paints the complete landing visualization.
@@ -154,90 +186,64 @@ protected:
      */
     void paintEvent(QPaintEvent *event) override;
 
+    /**
+     * @brief Recomputes the panel layout and rebuilds the static layer.
+     *
+     * @param event Resize event.
+     */
+    void resizeEvent(QResizeEvent *event) override;
+
 private:
+    /**
+     * @brief Telemetry sample used for interpolation.
+     */
+    struct TelemetryFrame
+    {
+        double time = 0.0;                  ///< Simulation time [s]
+        Vector3 position {0.0, 0.0, 0.0};   ///< Position (ENU) [m]
+        Vector3 velocity {0.0, 0.0, 0.0};   ///< Velocity (ENU) [m/s]
+        double thrustPercent = 0.0;         ///< Main Engine thrust [%]
+    };
+
     // =====================================================
     // Internal State
     // =====================================================
 
-    Vector3 positionENU {0.0, 0.0, 0.0}; ///< Current position (ENU)
-    Vector3 velocityENU {0.0, 0.0, 0.0}; ///< Current velocity (ENU)
-    Vector3 targetENU   {0.0, 0.0, 0.0}; ///< Target position (ENU)
-
-    double thrustPercent = 0.0; ///< Main Engine thrust [%]
-    bool RCSActive = false;     ///< Switch that represents if RCS engines are active [0,1]
-    int activeThruster = 0.0;   ///< Amount of engine which are active
-    double yawDeg = 0.0;        ///< Yaw angle [deg]
-
-    bool hullIntact = true;     ///< Hull integrity state
-
-    QVector<QPointF> trajectoryEN; ///< Trajectory history (E-N plane)
+    LandingViewScene scene;     ///< Everything drawn, see LandingViewScene
 
     // =====================================================
-    // Animation
+    // Render Cache
     // =====================================================
 
-    QTimer animationTimer; ///< Timer for motion stripe animation
-    int motionOffset = 0;  ///< Animation phase offset
+    LandingViewLayout layout;   ///< Panel rectangles for the current size
+    QImage staticLayer;         ///< Background, frames, grids and fixed labels
+    QRegion dirtyRegion;        ///< Panels to repaint on the next display frame
+
+    QThread *renderThread = nullptr;            ///< Thread of renderer, off-thread rendering only
+    LandingViewRenderer *renderer = nullptr;    ///< Off-thread renderer, null when painting on the GUI thread
 
     // =====================================================
-    // Rendering Helpers
+    // Frame Pacing
     // =====================================================
 
-    /**
-     * @brief Draws a framed panel with title.
-     */
-    void drawPanelFrame(QPainter& p, const QRect& r, const QString& title);
-
-    /**
-     * @brief Draws side view (East-Up plane).
-     */
-    void drawSideView(QPainter& p, const QRect& r);
-
-    /**
-     * @brief Draws top view (East-North plane).
-     */
-    void drawTopView(QPainter& p, const QRect& r);
-
-    /**
-     * @brief Draws compact state/telemetry panel.
-     */
-    void drawStatusBox(QPainter& p, const QRect& r);
+    TelemetryFrame previousFrame;   ///< Second newest telemetry frame
+    TelemetryFrame latestFrame;     ///< Newest telemetry frame
+    bool hasFrame = false;          ///< At least one frame received
 
-    /**
-     * @brief Maps ENU coordinates to side view screen coordinates.
-     */
-    QPointF mapSideView(const QRect& r,
-                        double east,
-                        double up,
-                        double maxEastAbs,
-                        double maxUp) const;
+    QElapsedTimer clock;            ///< Wall clock for frame pacing
+    qint64 latestArrivalNs = 0;     ///< Wall time latestFrame arrived [ns]
+    qint64 lastRenderNs = 0;        ///< Wall time of the last display frame [ns]
+    double frameInterval = 0.05;    ///< Smoothed wall time between telemetry frames [s]
 
-    /**
-     * @brief Maps ENU coordinates to top view screen coordinates.
-     */
-    QPointF mapTopView(const QRect& r,
-                       double east,
-                       double north,
-                       double maxEastAbs,
-                       double maxNorthAbs) const;
+    QTimer displayTimer;            ///< Fires at the display refresh rate
+    double motionPhase = 0.0;       ///< Motion stripe phase [px]
 
     /**
-     * @brief Draws lander in side view.
-     */
-    void drawLanderSide(QPainter& p, const QPointF& center);
-
-    /**
-     * @brief Draws lander in top view including yaw orientation.
-     */
-    void drawLanderTop(QPainter& p, const QPointF& center, double yawDeg);
-
-    /**
-     * @brief Draws vector (e.g. velocity or thrust).
+     * @brief Interpolates the rendered state for the current display frame.
+     *
+     * Marks the panels whose content changed as dirty.
      */
-    void drawVector(QPainter& p,
-                    const QPointF& start,
-                    const QPointF& vec,
-                    const QColor& color);
+    void advanceDisplayFrame();
 };
 
 #endif // LANDINGVIEW_H
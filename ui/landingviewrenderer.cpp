@@ -0,0 +1,71 @@
+#include "landingviewrenderer.h"
+
+#include <QMetaObject>
+#include <QPainter>
+
+LandingViewRenderer::LandingViewRenderer(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void LandingViewRenderer::submit(const LandingViewScene& scene, const QSize& size, qreal devicePixelRatio)
+{
+    Request& request = requests.back();
+    request.scene            = scene;
+    request.size             = size;
+    request.devicePixelRatio = devicePixelRatio;
+    requests.publish();
+
+    // One queued call at a time; it renders whatever is newest when it runs
+    if (!scheduled.exchange(true))
+    {
+        QMetaObject::invokeMethod(this, &LandingViewRenderer::renderLatest, Qt::QueuedConnection);
+    }
+}
+
+bool LandingViewRenderer::takeFrame()
+{
+    return frames.update();
+}
+
+const QImage& LandingViewRenderer::frame() const
+{
+    return frames.front();
+}
+
+void LandingViewRenderer::renderLatest()
+{
+    // Clear first: a scene submitted from now on queues a new call
+    scheduled.exchange(false);
+
+    if (!requests.update())
+        return;
+
+    const Request& request = requests.front();
+    if (request.size.isEmpty())
+        return;
+
+    // Static layer follows the widget size
+    if (request.size != layout.size || request.devicePixelRatio != layoutPixelRatio)
+    {
+        layout           = LandingViewLayout::forSize(request.size);
+        layoutPixelRatio = request.devicePixelRatio;
+        staticLayer      = LandingViewScene::drawStaticLayer(layout, layoutPixelRatio);
+    }
+
+    // Reuse the back image unless the size changed
+    QImage& image = frames.back();
+    const QSize pixelSize = request.size * request.devicePixelRatio;
+    if (image.size() != pixelSize)
+    {
+        image = QImage(pixelSize, QImage::Format_ARGB32_Premultiplied);
+    }
+    image.setDevicePixelRatio(request.devicePixelRatio);
+
+    QPainter p(&image);
+    request.scene.paint(p, layout, staticLayer, QRegion(QRect(QPoint(0, 0), request.size)));
+    p.end();
+
+    frames.publish();
+    emit frameReady();
+}
@@ -0,0 +1,98 @@
+/**
+ * @file landingviewrenderer.h
+ * @brief Renders landing view scenes into images on a background thread.
+ */
+
+#ifndef LANDINGVIEWRENDERER_H
+#define LANDINGVIEWRENDERER_H
+
+#include <QObject>
+#include <QImage>
+#include <QSize>
+
+#include <atomic>
+
+#include "landingviewscene.h"
+#include "tripleBuffer.h"
+
+/**
+ * @class LandingViewRenderer
+ * @brief Draws LandingViewScene snapshots into a QImage off the GUI thread.
+ *
+ * The object lives in its own QThread. The GUI thread hands over scenes with
+ * submit() and blits the finished image from frame(); painting never happens
+ * on the GUI thread.
+ *
+ * Both directions are latest-value slots (TripleBuffer):
+ * - A scene submitted while the previous one is still rendering replaces any
+ *   scene that has not started yet, so the renderer never falls behind.
+ * - A finished image replaces one the widget has not shown yet.
+ *
+ * At most one render request is queued to the render thread at a time.
+ */
+class LandingViewRenderer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the renderer; move it to its thread afterwards.
+     * @param parent Optional QObject parent
+     */
+    explicit LandingViewRenderer(QObject *parent = nullptr);
+
+    /**
+     * @brief Queues a scene for rendering; GUI thread only.
+     *
+     * @param scene Scene snapshot, copied
+     * @param size Widget size
+     * @param devicePixelRatio Device pixel ratio of the widget
+     */
+    void submit(const LandingViewScene& scene, const QSize& size, qreal devicePixelRatio);
+
+    /**
+     * @brief Takes the newest finished image; GUI thread only.
+     * @return True if frame() changed
+     */
+    bool takeFrame();
+
+    /**
+     * @brief Image taken by the last takeFrame(); GUI thread only.
+     * @return Image in widget size times device pixel ratio, null before the first frame
+     */
+    const QImage& frame() const;
+
+signals:
+    /**
+     * @brief Emitted from the render thread when an image was published.
+     */
+    void frameReady();
+
+public slots:
+    /**
+     * @brief Renders the newest submitted scene; render thread only.
+     */
+    void renderLatest();
+
+private:
+    /**
+     * @brief Scene snapshot with the target it was taken for.
+     */
+    struct Request
+    {
+        LandingViewScene scene;
+        QSize size;
+        qreal devicePixelRatio = 1.0;
+    };
+
+    TripleBuffer<Request> requests;         ///< GUI → render thread
+    TripleBuffer<QImage> frames;            ///< Render thread → GUI
+    std::atomic<bool> scheduled {false};    ///< renderLatest is queued
+
+    // --- Render thread only ---
+    LandingViewLayout layout;               ///< Layout of the last rendered size
+    qreal layoutPixelRatio = 0.0;           ///< Device pixel ratio of staticLayer
+    QImage staticLayer;                     ///< Background, frames, grids and fixed labels
+};
+
+#endif // LANDINGVIEWRENDERER_H
@@ -0,0 +1,347 @@
+#include "landingviewscene.h"
+
+#include <QLineF>
+#include <QPen>
+#include <QStringList>
+#include <QtMath>
+
+namespace
+{
+constexpr int STATUS_LIVE_LINES = 10;   ///< Status lines redrawn every frame, the fixed ones follow
+}
+
+// -------------------------------------------------------------------------
+// Layout
+// -------------------------------------------------------------------------
+LandingViewLayout LandingViewLayout::forSize(const QSize& size)
+{
+    LandingViewLayout layout;
+    layout.size = size;
+
+    const int margin = 10;
+    const int gap = 8;
+
+    QRect content = QRect(QPoint(0, 0), size).adjusted(margin, margin, -margin, -margin);
+
+    const int topHeight = static_cast<int>(content.height() * 0.58);
+    const int bottomHeight = content.height() - topHeight - gap;
+
+    layout.sideRect = QRect(content.left(), content.top(), content.width(), topHeight);
+
+    const int statusWidth = static_cast<int>(content.width() * 0.34);
+    layout.statusRect = QRect(content.left(),
+                              layout.sideRect.bottom() + gap,
+                              statusWidth,
+                              bottomHeight);
+
+    layout.topRect = QRect(layout.statusRect.right() + gap,
+                           layout.sideRect.bottom() + gap,
+                           content.width() - statusWidth - gap,
+                           bottomHeight);
+
+    return layout;
+}
+
+// -------------------------------------------------------------------------
+// Scene
+// -------------------------------------------------------------------------
+bool LandingViewScene::appendTrail(const QPointF& point)
+{
+    if (trailCount > 0) {
+        const QPointF& last = trajectoryEN[(trailNext + TRAIL_CAPACITY - 1) % TRAIL_CAPACITY];
+        if (QLineF(last, point).length() <= 0.5) {
+            return false;
+        }
+    }
+
+    trajectoryEN[trailNext] = point;
+    trajectoryEN[trailNext + TRAIL_CAPACITY] = point;
+    trailNext = (trailNext + 1) % TRAIL_CAPACITY;
+    trailCount = qMin(trailCount + 1, TRAIL_CAPACITY);
+    return true;
+}
+
+QImage LandingViewScene::drawStaticLayer(const LandingViewLayout& layout, qreal devicePixelRatio)
+{
+    if (layout.size.isEmpty())
+        return QImage();
+
+    QImage staticLayer(layout.size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    staticLayer.setDevicePixelRatio(devicePixelRatio);
+    staticLayer.fill(QColor("#0E1624"));
+
+    QPainter p(&staticLayer);
+    p.setRenderHint(QPainter::Antialiasing);
+
+    drawPanelFrame(p, layout.sideRect, "SIDE VIEW (E-UP)");
+    drawGrid(p, layout.sideRect);
+
+    const QRect sidePlot = layout.sideRect.adjusted(12, 26, -12, -12);
+    p.setPen(QPen(QColor("#6D4C41"), 3));
+    p.drawLine(sidePlot.left(), sidePlot.bottom(), sidePlot.right(), sidePlot.bottom());
+
+    drawPanelFrame(p, layout.topRect, "TOP VIEW (E-N)");
+    drawGrid(p, layout.topRect);
+
+    // axes through center
+    const QRect topPlot = layout.topRect.adjusted(12, 26, -12, -12);
+    p.setPen(QPen(QColor("#355070"), 1, Qt::DashLine));
+    p.drawLine(topPlot.center().x(), topPlot.top(), topPlot.center().x(), topPlot.bottom());
+    p.drawLine(topPlot.left(), topPlot.center().y(), topPlot.right(), topPlot.center().y());
+
+    drawPanelFrame(p, layout.statusRect, "STATE");
+
+    // Fixed status lines below the live values
+    const QStringList fixedLines{"Frame : LOCAL ENU", "Ref   : MCI", "Axes  : X=E  Y=N  Z=U"};
+    const QRect textRect = layout.statusRect.adjusted(12, 28, -12, -12);
+    const int lineHeight = 16;
+    p.setPen(QColor("#D6E1F0"));
+    for (int i = 0; i < fixedLines.size(); ++i) {
+        QRect lineRect(textRect.left(), textRect.top() + (STATUS_LIVE_LINES + i) * lineHeight, textRect.width(), lineHeight);
+        p.drawText(lineRect, Qt::AlignLeft | Qt::AlignVCenter, fixedLines[i]);
+    }
+
+    p.end();
+    return staticLayer;
+}
+
+void LandingViewScene::paint(QPainter& p, const LandingViewLayout& layout, const QImage& staticLayer, const QRegion& region) const
+{
+    // Static layer for the exposed area only; the painter clips to the update region
+    const QRectF target(region.boundingRect());
+    const qreal dpr = staticLayer.devicePixelRatio();
+    p.drawImage(target, staticLayer, QRectF(target.topLeft() * dpr, target.size() * dpr));
+
+    p.setRenderHint(QPainter::Antialiasing);
+
+    const auto drawPanel = [&](const QRect& r, void (LandingViewScene::*draw)(QPainter&, const QRect&) const) {
+        if (!region.intersects(r))
+            return;
+        p.save();
+        p.setClipRect(r, Qt::IntersectClip);
+        (this->*draw)(p, r);
+        p.restore();
+    };
+
+    drawPanel(layout.sideRect, &LandingViewScene::drawSideView);
+    drawPanel(layout.statusRect, &LandingViewScene::drawStatusBox);
+    drawPanel(layout.topRect, &LandingViewScene::drawTopView);
+}
+
+void LandingViewScene::drawPanelFrame(QPainter& p, const QRect& r, const QString& title)
+{
+    p.setPen(QPen(QColor("#2F4A72"), 1));
+    p.setBrush(QColor(10, 18, 30, 120));
+    p.drawRoundedRect(r, 6, 6);
+
+    QRect titleRect = QRect(r.left() + 8, r.top() + 6, r.width() - 16, 16);
+    p.setPen(QColor("#4FC3F7"));
+    p.drawText(titleRect, Qt::AlignLeft | Qt::AlignVCenter, title);
+}
+
+QPointF LandingViewScene::mapSideView(const QRect& r, double east, double up,
+                                      double maxEastAbs, double maxUp) const
+{
+    const QRect plot = r.adjusted(12, 26, -12, -12);
+
+    const double xNorm = (east + maxEastAbs) / (2.0 * maxEastAbs);
+    const double yNorm = 1.0 - qBound(0.0, up / maxUp, 1.0);
+
+    return QPointF(plot.left() + xNorm * plot.width(),
+                   plot.top() + yNorm * plot.height());
+}
+
+QPointF LandingViewScene::mapTopView(const QRect& r, double east, double north,
+                                     double maxEastAbs, double maxNorthAbs) const
+{
+    const QRect plot = r.adjusted(12, 26, -12, -12);
+
+    const double xNorm = (east + maxEastAbs) / (2.0 * maxEastAbs);
+    const double yNorm = 1.0 - ((north + maxNorthAbs) / (2.0 * maxNorthAbs));
+
+    return QPointF(plot.left() + xNorm * plot.width(),
+                   plot.top() + yNorm * plot.height());
+}
+
+void LandingViewScene::drawLanderSide(QPainter& p, const QPointF& center) const
+{
+    QColor hullColor = hullIntact ? QColor("#CFD8DC") : QColor("#E53935");
+    p.setPen(QPen(Qt::black, 1));
+    p.setBrush(hullColor);
+
+    QRectF body(center.x() - 10, center.y() - 14, 20, 20);
+    p.drawRoundedRect(body, 3, 3);
+
+    p.setPen(QPen(QColor("#90A4AE"), 2));
+    p.drawLine(QPointF(body.left() + 2, body.bottom()),
+               QPointF(body.left() - 8, body.bottom() + 10));
+    p.drawLine(QPointF(body.right() - 2, body.bottom()),
+               QPointF(body.right() + 8, body.bottom() + 10));
+
+    p.setBrush(QColor("#4FC3F7"));
+    p.setPen(Qt::NoPen);
+    p.drawEllipse(QPointF(center.x(), center.y() - 5), 3, 3);
+}
+
+void LandingViewScene::drawLanderTop(QPainter& p, const QPointF& center, double yawDeg_) const
+{
+    QColor hullColor = hullIntact ? QColor("#CFD8DC") : QColor("#E53935");
+
+    p.save();
+    p.translate(center);
+    p.rotate(-yawDeg_);
+
+    p.setPen(QPen(Qt::black, 1));
+    p.setBrush(hullColor);
+    p.drawRoundedRect(QRectF(-10, -10, 20, 20), 3, 3);
+
+    p.setPen(QPen(QColor("#4FC3F7"), 2));
+    p.drawLine(QPointF(0, 0), QPointF(0, -14));
+
+    p.restore();
+}
+
+void LandingViewScene::drawVector(QPainter& p, const QPointF& start, const QPointF& vec, const QColor& color) const
+{
+    p.setPen(QPen(color, 2));
+    QPointF end = start + vec;
+    p.drawLine(start, end);
+
+    QLineF line(start, end);
+    if (line.length() < 1.0) {
+        return;
+    }
+
+    const double arrowSize = 6.0;
+    QLineF left = line;
+    left.setLength(arrowSize);
+    left.setAngle(line.angle() + 150);
+
+    QLineF right = line;
+    right.setLength(arrowSize);
+    right.setAngle(line.angle() - 150);
+
+    p.drawLine(end, left.p2());
+    p.drawLine(end, right.p2());
+}
+
+void LandingViewScene::drawGrid(QPainter& p, const QRect& r)
+{
+    const QRect plot = r.adjusted(12, 26, -12, -12);
+
+    p.setPen(QPen(QColor("#24364F"), 1));
+    for (int i = 1; i < 4; ++i) {
+        int x = plot.left() + i * plot.width() / 4;
+        int y = plot.top() + i * plot.height() / 4;
+        p.drawLine(x, plot.top(), x, plot.bottom());
+        p.drawLine(plot.left(), y, plot.right(), y);
+    }
+}
+
+void LandingViewScene::drawSideView(QPainter& p, const QRect& r) const
+{
+    const QRect plot = r.adjusted(12, 26, -12, -12);
+    const int groundY = plot.bottom();
+
+    const double maxEastAbs = qMax(50.0, qAbs(positionENU.x) + 10.0);
+    const double maxUp = qMax(50.0, positionENU.z + 20.0);
+
+    QPointF landerPos = mapSideView(r, positionENU.x, positionENU.z, maxEastAbs, maxUp);
+    QPointF targetPos = mapSideView(r, targetENU.x, 0.0, maxEastAbs, maxUp);
+
+    p.setPen(QPen(QColor("#66BB6A"), 2));
+    p.setBrush(QColor("#66BB6A"));
+    p.drawEllipse(targetPos, 4, 4);
+
+    p.setPen(QPen(QColor("#66BB6A"), 1, Qt::DashLine));
+    p.drawLine(QPointF(targetPos.x(), plot.top()), QPointF(targetPos.x(), plot.bottom()));
+
+    drawLanderSide(p, landerPos);
+
+    // Velocity vector in side view: East + Up
+    const QPointF velVec(positionENU.x + velocityENU.x * 2.0, positionENU.z + velocityENU.z * 2.0);
+    QPointF velEnd = mapSideView(r, velVec.x(), velVec.y(), maxEastAbs, maxUp);
+    drawVector(p, landerPos, velEnd - landerPos, QColor("#FFD54F"));
+
+    // Thrust vector visually upward from lander
+    if (thrustPercent > 0.0) {
+        const double thrustScale = 0.35 * thrustPercent;
+        drawVector(p, landerPos, QPointF(0.0, -thrustScale), QColor("#4FC3F7"));
+    }
+
+    // Motion stripes under lander
+    p.setPen(QPen(QColor(255, 255, 255, 35), 2));
+    for (int i = 0; i < 5; ++i) {
+        int y = static_cast<int>(landerPos.y()) + 24 + (i * 14) + motionOffset;
+        if (y >= groundY) {
+            continue;
+        }
+        p.drawLine(static_cast<int>(landerPos.x()) - 24, y,
+                   static_cast<int>(landerPos.x()) + 24, y);
+    }
+}
+
+void LandingViewScene::drawTopView(QPainter& p, const QRect& r) const
+{
+    const QRect plot = r.adjusted(12, 26, -12, -12);
+
+    const double maxEastAbs = qMax(50.0, qMax(qAbs(positionENU.x), qAbs(targetENU.x)) + 10.0);
+    const double maxNorthAbs = qMax(50.0, qMax(qAbs(positionENU.y), qAbs(targetENU.y)) + 10.0);
+
+    QPointF landerPos = mapTopView(r, positionENU.x, positionENU.y, maxEastAbs, maxNorthAbs);
+    QPointF targetPos = mapTopView(r, targetENU.x, targetENU.y, maxEastAbs, maxNorthAbs);
+
+    // trail: one polyline in E-N metres, mapped like mapTopView by the painter
+    if (trailCount > 1) {
+        QPen trailPen(QColor("#4FC3F7"), 1);
+        trailPen.setCosmetic(true);
+
+        p.save();
+        p.setClipRect(plot);
+        p.translate(plot.left() + 0.5 * plot.width(), plot.top() + 0.5 * plot.height());
+        p.scale(0.5 * plot.width() / maxEastAbs, -0.5 * plot.height() / maxNorthAbs);
+        p.setPen(trailPen);
+        p.drawPolyline(&trajectoryEN[trailNext + TRAIL_CAPACITY - trailCount], trailCount);
+        p.restore();
+    }
+
+    p.setPen(QPen(QColor("#66BB6A"), 2));
+    p.setBrush(QColor("#66BB6A"));
+    p.drawEllipse(targetPos, 4, 4);
+
+    drawLanderTop(p, landerPos, yawDeg);
+
+    // lateral velocity vector (E,N)
+    QPointF velEnd = mapTopView(r,
+                                positionENU.x + velocityENU.x * 2.0,
+                                positionENU.y + velocityENU.y * 2.0,
+                                maxEastAbs,
+                                maxNorthAbs);
+    drawVector(p, landerPos, velEnd - landerPos, QColor("#FFD54F"));
+}
+
+void LandingViewScene::drawStatusBox(QPainter& p, const QRect& r) const
+{
+    QRect textRect = r.adjusted(12, 28, -12, -12);
+    p.setPen(QColor("#D6E1F0"));
+
+    const double lateralSpeed = qSqrt(velocityENU.x * velocityENU.x + velocityENU.y * velocityENU.y);
+
+    QStringList lines;
+    lines << QString("E  : %1 m").arg(positionENU.x, 0, 'f', 1)
+          << QString("N  : %1 m").arg(positionENU.y, 0, 'f', 1)
+          << QString("U  : %1 m").arg(positionENU.z, 0, 'f', 1)
+          << QString("VE : %1 m/s").arg(velocityENU.x, 0, 'f', 1)
+          << QString("VN : %1 m/s").arg(velocityENU.y, 0, 'f', 1)
+          << QString("VU : %1 m/s").arg(velocityENU.z, 0, 'f', 1)
+          << QString("Vlat: %1 m/s").arg(lateralSpeed, 0, 'f', 1)
+          << QString("Yaw : %1 deg").arg(yawDeg, 0, 'f', 1)
+          << QString("Main Throttle [%]: %1 %").arg(thrustPercent, 0, 'f', 0)
+          << QString("RCS : %1").arg(RCSActive ? "ACTIVE" : "INACTIVE");
+
+    const int lineHeight = 16;
+    for (int i = 0; i < lines.size(); ++i) {
+        QRect lineRect(textRect.left(), textRect.top() + i * lineHeight, textRect.width(), lineHeight);
+        p.drawText(lineRect, Qt::AlignLeft | Qt::AlignVCenter, lines[i]);
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file landingviewscene.h
+ * @brief Render state and drawing code of the landing view.
+ *
+ * The scene is a plain value: everything needed to draw one landing view
+ * frame, without any reference to a widget. LandingView draws it on the GUI
+ * thread, LandingViewRenderer draws a copy of it on a render thread.
+ *
+ * Only QPainter on QImage is used, which is safe outside the GUI thread.
+ */
+
+#ifndef LANDINGVIEWSCENE_H
+#define LANDINGVIEWSCENE_H
+
+#include <QImage>
+#include <QPainter>
+#include <QPointF>
+#include <QRect>
+#include <QRegion>
+
+#include <array>
+
+#include <vector3.h>
+
+/**
+ * @struct LandingViewLayout
+ * @brief Panel rectangles of the landing view for a widget size.
+ */
+struct LandingViewLayout
+{
+    QSize size;         ///< Widget size
+    QRect sideRect;     ///< Side view panel
+    QRect statusRect;   ///< State panel
+    QRect topRect;      ///< Top view panel
+
+    /**
+     * @brief Computes the panel layout.
+     * @param size Widget size
+     */
+    static LandingViewLayout forSize(const QSize& size);
+};
+
+/**
+ * @class LandingViewScene
+ * @brief Everything drawn by the landing view for one frame.
+ *
+ * Copying a scene is cheap (a few kB, no heap), so it can be handed to a
+ * render thread as a snapshot.
+ */
+class LandingViewScene
+{
+public:
+    static constexpr int TRAIL_CAPACITY = 200; ///< Trajectory points kept
+
+    // =====================================================
+    // State
+    // =====================================================
+
+    Vector3 positionENU {0.0, 0.0, 0.0}; ///< Rendered position (ENU), interpolated
+    Vector3 velocityENU {0.0, 0.0, 0.0}; ///< Rendered velocity (ENU), interpolated
+    Vector3 targetENU   {0.0, 0.0, 0.0}; ///< Target position (ENU)
+
+    double thrustPercent = 0.0; ///< Rendered Main Engine thrust [%], interpolated
+    bool RCSActive = false;     ///< Switch that represents if RCS engines are active [0,1]
+    int activeThruster = 0.0;   ///< Amount of engine which are active
+    double yawDeg = 0.0;        ///< Yaw angle [deg]
+
+    bool hullIntact = true;     ///< Hull integrity state
+
+    int motionOffset = 0;       ///< Animation phase offset
+
+    /**
+     * @brief Trajectory history (E-N plane) [m].
+     *
+     * Every point is written twice, at i and i + TRAIL_CAPACITY, so the newest
+     * trailCount points are always contiguous and drawn without copying.
+     */
+    std::array<QPointF, 2 * TRAIL_CAPACITY> trajectoryEN;
+    int trailNext = 0;          ///< Ring index of the next point
+    int trailCount = 0;         ///< Points in the trail
+
+    // =====================================================
+    // Drawing
+    // =====================================================
+
+    /**
+     * @brief Appends a point to the trajectory ring.
+     * @return False if the point was too close to the last one and skipped
+     */
+    bool appendTrail(const QPointF& point);
+
+    /**
+     * @brief Draws everything that only depends on the widget size.
+     *
+     * @param layout Panel layout
+     * @param devicePixelRatio Device pixel ratio of the target
+     * @return Static layer in device pixels, null for an empty layout
+     */
+    static QImage drawStaticLayer(const LandingViewLayout& layout, qreal devicePixelRatio);
+
+    /**
+     * @brief Paints the static layer and the panels touching @p region.
+     *
+     * Each panel is clipped to itself, so a partial repaint never leaves stale
+     * pixels in a neighbour.
+     *
+     * @param p Painter in widget coordinates
+     * @param layout Panel layout
+     * @param staticLayer Result of drawStaticLayer() for @p layout
+     * @param region Area to repaint
+     */
+    void paint(QPainter& p, const LandingViewLayout& layout, const QImage& staticLayer, const QRegion& region) const;
+
+private:
+    /**
+     * @brief Draws a framed panel with title.
+     */
+    static void drawPanelFrame(QPainter& p, const QRect& r, const QString& title);
+
+    /**
+     * @brief Draws the grid of side and top view into the static layer.
+     */
+    static void drawGrid(QPainter& p, const QRect& r);
+
+    /**
+     * @brief Draws side view (East-Up plane).
+     */
+    void drawSideView(QPainter& p, const QRect& r) const;
+
+    /**
+     * @brief Draws top view (East-North plane).
+     */
+    void drawTopView(QPainter& p, const QRect& r) const;
+
+    /**
+     * @brief Draws compact state/telemetry panel.
+     */
+    void drawStatusBox(QPainter& p, const QRect& r) const;
+
+    /**
+     * @brief Maps ENU coordinates to side view screen coordinates.
+     */
+    QPointF mapSideView(const QRect& r,
+                        double east,
+                        double up,
+                        double maxEastAbs,
+                        double maxUp) const;
+
+    /**
+     * @brief Maps ENU coordinates to top view screen coordinates.
+     */
+    QPointF mapTopView(const QRect& r,
+                       double east,
+                       double north,
+                       double maxEastAbs,
+                       double maxNorthAbs) const;
+
+    /**
+     * @brief Draws lander in side view.
+     */
+    void drawLanderSide(QPainter& p, const QPointF& center) const;
+
+    /**
+     * @brief Draws lander in top view including yaw orientation.
+     */
+    void drawLanderTop(QPainter& p, const QPointF& center, double yawDeg) const;
+
+    /**
+     * @brief Draws vector (e.g. velocity or thrust).
+     */
+    void drawVector(QPainter& p,
+                    const QPointF& start,
+                    const QPointF& vec,
+                    const QColor& color) const;
+};
+
+#endif // LANDINGVIEWSCENE_H
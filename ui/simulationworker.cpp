@@ -4,59 +4,41 @@
 
 SimulationWorker::SimulationWorker(QObject *parent)
     : QObject(parent)
+    , loop(std::make_unique<SimulationLoop>(FRAME_PERIOD))
 {
-    // Build timer event
-    simulationTimer = new QTimer(this);
-    simulationTimer->setInterval(50); // 20 Hz
+    // Build poll timer, faster than the loop so no frame waits long
+    pollTimer = new QTimer(this);
+    pollTimer->setInterval(POLL_INTERVAL_MS);
 
-    // connect timer with worker function
-    connect(simulationTimer, &QTimer::timeout, this, &SimulationWorker::stepSimulation);
+    // connect timer with poll function
+    connect(pollTimer, &QTimer::timeout, this, &SimulationWorker::pollSimulation);
 }
 
 void SimulationWorker::start()
 {
-    try {
-        controller = std::make_unique<simcontrol>(0);
-        controller->initialize(jsonConfig);
-    }
-    catch (const std::exception& e)
-    {
-        qCritical() << "Simulation start failed: " << e.what();
-        emit simulationError(QString::fromStdString(e.what()));
-    }
+    SimCommand command;
+    command.type = SimCommand::Type::Start;
+    command.config = jsonConfig;
+    send(std::move(command));
 
-    running = true;
-    simulationTimer->start();
+    if (!pollTimer->isActive())
+        pollTimer->start();
 
-    qDebug("[simulationworker]-start-: Simulation started successfully");
+    qDebug("[simulationworker]-start-: Simulation start requested");
 }
 
 void SimulationWorker::pause()
 {
-    running = false;
-    simulationTimer->stop();
+    SimCommand command;
+    command.type = SimCommand::Type::Pause;
+    send(std::move(command));
 }
 
 void SimulationWorker::stop()
 {
-    running = false;
-    simulationTimer->stop();
-    currentTime = 0.0;
-
-    emit stateUpdated(currentTime,
-                      {0.0, 0.0, 0.0},
-                      {0.0, 0.0, 0.0},
-                      0.0,
-                      SpacecraftState::Operational,
-                      {0.0, 0.0, 0.0},
-                      {0.0, 0.0, 0.0},
-                      {0.0, 0.0, 0.0},
-                      QVector<FuelTank>{},
-                      0.0,
-                      0.0,
-                      "");
-
-    controller->setResetBoolean();
+    SimCommand command;
+    command.type = SimCommand::Type::Stop;
+    send(std::move(command));
 }
 
 void SimulationWorker::receiveJsonConfig(const QString &json)
@@ -69,53 +51,94 @@ void SimulationWorker::receiveJsonConfig(const QString &json)
 
 void SimulationWorker::setFlightCommand(FlightCommand cmd)
 {
-    QMutexLocker locker(&mutex);
-
     collectControlCommands(cmd);
+    sendControlCommands();
 }
 
 void SimulationWorker::setAutopilotFlag(bool active)
 {
-    QMutexLocker locker(&mutex); // protect access
     collectAutopilotCommand(active);
+    sendControlCommands();
 }
 
-void SimulationWorker::stepSimulation()
+void SimulationWorker::pollSimulation()
 {
-    double dt = 0.00;   ///< Initialized discrete timestep
+    // Events first, so an error is reported before the frame it interrupted
+    while (loop->pollEvent(event))
+    {
+        switch (event.type)
+        {
+        case SimEvent::Type::Error:
+            qCritical() << "Simulation error: " << event.message.c_str();
+            emit simulationError(QString::fromStdString(event.message));
+            break;
+
+        case SimEvent::Type::TimeWarpChanged:
+            emit timeWarpChanged(event.value);
+            break;
+        }
+    }
+
+    // Only the newest frame; older ones were overwritten in the loop
+    if (!loop->latestFrame(frame))
+        return;
 
-    // Return if not running
-    if(!running)
+    if (frame.stopped)
+    {
+        emit stateUpdated(0.0,
+                          {0.0, 0.0, 0.0},
+                          {0.0, 0.0, 0.0},
+                          0.0,
+                          SpacecraftState::Operational,
+                          {0.0, 0.0, 0.0},
+                          {0.0, 0.0, 0.0},
+                          {0.0, 0.0, 0.0},
+                          QVector<FuelTank>{},
+                          0.0,
+                          0.0,
+                          "");
         return;
+    }
 
-    // times
-    dt = 0.05; // TODO: should specified in json as well
-    currentTime += dt;
+    emitState(frame.time, frame.data);
+}
 
-    // Calling backend simulator
-    spacecraftData = controller->runSimulation(dt);
+void SimulationWorker::rewind(double seconds)
+{
+    SimCommand command;
+    command.type = SimCommand::Type::Rewind;
+    command.value = seconds;
+    send(std::move(command));
+}
 
-    // Withdraw user input due to thrust
-    sendControlCommands();
+void SimulationWorker::setTimeWarp(double factor)
+{
+    SimCommand command;
+    command.type = SimCommand::Type::TimeWarp;
+    command.value = factor;
+    send(std::move(command));
+}
 
+void SimulationWorker::emitState(double time, const simData &data)
+{
     // Change data type for console output
-    QString consoleOutput = QString::fromStdString(spacecraftData.output);
+    QString consoleOutput = QString::fromStdString(data.output);
 
     // Change vector type for fuel tanks information
-    QVector<FuelTank> fuelTanksQVec(spacecraftData.tanks.begin(), spacecraftData.tanks.end());
+    QVector<FuelTank> fuelTanksQVec(data.tanks.begin(), data.tanks.end());
 
     // signals
-    emit stateUpdated(currentTime,
-                      spacecraftData.statevector_.I_Position,
-                      spacecraftData.statevector_.I_Velocity,
-                      spacecraftData.GLoad,
-                      spacecraftData.spacecraftState_,
-                      spacecraftData.ME_ThrustState_.direction * spacecraftData.ME_ThrustState_.current,
-                      spacecraftData.ME_ThrustState_.direction * spacecraftData.ME_ThrustState_.target,
-                      spacecraftData.ME_ThrustState_.direction * spacecraftData.ME_ThrustState_.targetPercentage,
+    emit stateUpdated(time,
+                      data.statevector_.I_Position,
+                      data.statevector_.I_Velocity,
+                      data.GLoad,
+                      data.spacecraftState_,
+                      data.ME_ThrustState_.direction * data.ME_ThrustState_.current,
+                      data.ME_ThrustState_.direction * data.ME_ThrustState_.target,
+                      data.ME_ThrustState_.direction * data.ME_ThrustState_.targetPercentage,
                       fuelTanksQVec,
-                      spacecraftData.fuelMass,
-                      spacecraftData.fuelFlow,
+                      data.fuelMass,
+                      data.fuelFlow,
                       consoleOutput
                       );
 }
@@ -140,9 +163,19 @@ void SimulationWorker::collectAutopilotCommand(bool autopilotActive)
 
 void SimulationWorker::sendControlCommands()
 {
-    // Call Back End function
     // TODO: Change that with Issue 19
-    controller->receiveCommandFromFrontEnd(FEControlCommands_);
+    SimCommand command;
+    command.type = SimCommand::Type::Control;
+    command.control = FEControlCommands_;
+    send(std::move(command));
+}
+
+void SimulationWorker::send(SimCommand command)
+{
+    if (!loop->send(std::move(command)))
+    {
+        qWarning() << "[simulationworker]-send-: Command queue full, command dropped";
+    }
 }
 
 
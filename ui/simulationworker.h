@@ -1,9 +1,10 @@
 /**
  * @file simulationworker.h
- * @brief Worker object executing the lunar lander simulation in a separate thread.
+ * @brief Qt adapter between the UI and the backend simulation thread.
  *
- * The SimulationWorker owns the simulation backend and performs
- * time-stepped simulation updates independently of the UI thread.
+ * The SimulationWorker owns a SimulationLoop, which runs the simulation on its
+ * own thread. The worker forwards UI requests as commands and turns the
+ * published telemetry into Qt signals.
  */
 
 #ifndef SIMULATIONWORKER_H
@@ -12,19 +13,21 @@
 #include <QObject>
 #include <QTimer>
 #include <QDebug>
-#include <QMutexLocker>
 #include <QVector>
 
-#include "simcontrol.h"
+#include <memory>
+
+#include "simulationLoop.h"
 #include "flightcommandstruct.h"
 
 /**
  * @class SimulationWorker
- * @brief Executes the simulation loop in a worker thread.
+ * @brief Connects the UI to the SimulationLoop.
  *
- * This class encapsulates the simulation backend and periodically
- * advances the simulation state. Updated state data is emitted via
- * Qt signals and consumed by the UI.
+ * Slots queue commands into the loop without waiting for it. A poll timer
+ * takes the newest telemetry frame and pending events and emits them as Qt
+ * signals for the UI. Frames published between two polls are skipped, so a
+ * busy UI never slows down the simulation.
  */
 class SimulationWorker : public QObject
 {
@@ -70,12 +73,31 @@ public slots:
      */
     void setAutopilotFlag(bool active);
 
+    /**
+     * @brief Rewinds the simulation using the snapshot history
+     *
+     * Restores the newest snapshot at least @p seconds in the past and resumes
+     * from there. Works while running or paused.
+     *
+     * @param seconds [s] Simulated time to rewind
+     */
+    void rewind(double seconds);
+
+    /**
+     * @brief Sets the time warp requested by the pilot
+     *
+     * The applied warp may be lower, see simcontrol::allowedTimeWarp.
+     * @param factor [-] Requested warp factor
+     */
+    void setTimeWarp(double factor);
+
 signals:
     /**
-     * @brief Emitted after each simulation step.
+     * @brief Emitted for each new telemetry frame taken from the simulation loop.
      *
      * This signal provides the complete spacecraft state required by the UI.
-     * It reflects the current simulation results after one discrete time step.
+     * It reflects the newest simulation results; frames the UI did not poll in
+     * time are skipped.
      *
      * @param time Simulation time [s]
      *
@@ -115,28 +137,32 @@ signals:
      */
     void simulationError(QString errorMsg);
 
+    /**
+     * @brief Emitted when the applied time warp changes.
+     * @param effectiveWarp [-] Warp factor of the simulation
+     */
+    void timeWarpChanged(double effectiveWarp);
+
 public slots:
     /**
-     * @brief Adavnces the simulation by one timestep.
+     * @brief Takes the newest telemetry and pending events from the simulation loop.
      */
-    void stepSimulation();
+    void pollSimulation();
 
 private:
      // ==========================
      // Internal State
      // ==========================
-    simData spacecraftData;
+    static constexpr double FRAME_PERIOD = 0.05;    ///< Simulation frame period, 20 Hz [s]
+    static constexpr int POLL_INTERVAL_MS = 16;     ///< Telemetry poll interval, faster than the frame rate [ms]
+
     ControlCommand FEControlCommands_;
-    std::unique_ptr<simcontrol> controller;
+    std::unique_ptr<SimulationLoop> loop; ///< Simulation thread
 
     std::string jsonConfig;     ///< String with spacecraft config data
-    QTimer *simulationTimer;    ///< Drives simulation ticks
-    bool running = false;       ///< Simulation running flag
-
-    double currentTime = 0.0;   ///< Simulation time [s]
-
-    QMutex mutex;               ///< Thread safety
-    double requestedThrustPercent = 0.0; ///< Desired thrust in percentage
+    QTimer *pollTimer;          ///< Drives telemetry polling
+    SimFrame frame;             ///< Last telemetry frame taken from the loop
+    SimEvent event;             ///< Last event taken from the loop
 
     // ==========================
     // Private Methods
@@ -168,11 +194,23 @@ private:
      * @brief Sends the currently collected control commands to the backend.
      *
      * This function forwards the stored user and/or autopilot commands to the
-     * arbiter, which decides which commands are active. Ensures frontend cannot
-     * directly manipulate automation commands.
+     * simulation loop, whose arbiter decides which commands are active. Ensures
+     * frontend cannot directly manipulate automation commands.
      */
     void sendControlCommands();
 
+    /**
+     * @brief Queues a command for the simulation loop
+     * @param command Command
+     */
+    void send(SimCommand command);
+
+    /**
+     * @brief Emits stateUpdated for the given simulation data
+     * @param time Simulation time [s]
+     * @param data Simulation data of the current step
+     */
+    void emitState(double time, const simData &data);
 
 
 };